@@ -1,6 +1,54 @@
 #include <iostream>
 #include <vector>
 #include <cassert>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <memory>
+#include <iterator>
+#include <cstddef>
+#include <functional>
+#include <chrono>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <string_view>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IPPL_HAVE_SSE2 1
+#endif
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 /// <summary>
 /// Status hasil pengujian/validasi.
@@ -166,6 +214,20 @@ bool isSorted(const std::vector<int>& arr) {
     return true;
 }
 
+/// <summary>
+/// Overload <see cref="isSorted"/> untuk bilangan 64-bit.
+/// </summary>
+/// <param name="arr">Vektor bilangan bulat 64-bit.</param>
+/// <returns>True jika non-menurun, selain itu false.</returns>
+bool isSorted(const std::vector<int64_t>& arr) {
+    for (size_t i = 1; i < arr.size(); ++i) {
+        if (arr[i] < arr[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /// <summary>
 /// Kumpulan uji untuk <see cref="isSorted"/> dengan contoh terurut dan tidak terurut.
 /// </summary>
@@ -317,23 +379,23 @@ void testFibonacci() {
     std::cout << "Semua uji Fibonacci lulus!\n";
 }
 
+bool isPrimeByTrialDivision(uint32_t n);
+
 /// <summary>
-/// 10) Mengecek apakah bilangan prima menggunakan pendekatan 6k+/-1.
+/// 10) Mengecek apakah bilangan prima dengan pembagian percobaan.
 /// </summary>
 /// <param name="n">Bilangan bulat.</param>
 /// <returns>True jika prima; selain itu false.</returns>
 /// <remarks>
-/// Mengeliminasi kelipatan 2 dan 3, lalu memeriksa faktor hingga sqrt(n) dengan langkah 6.
-/// Kompleksitas ~O(sqrt(n).
+/// Mengeliminasi kelipatan 2 dan 3, lalu memeriksa faktor prima hingga sqrt(n). Alih-alih
+/// operasi % untuk setiap kandidat 6k+/-1, dipakai uji keterbagian invarian dari
+/// <see cref="isPrimeByTrialDivision"/>. Kompleksitas ~O(sqrt(n) / ln n).
 /// </remarks>
 bool isPrime(int n) {
     if (n <= 1) return false;
     if (n <= 3) return true;
     if (n % 2 == 0 || n % 3 == 0) return false;
-    for (int i = 5; i * i <= n; i += 6) {
-        if (n % i == 0 || n % (i + 2) == 0) return false;
-    }
-    return true;
+    return isPrimeByTrialDivision(static_cast<uint32_t>(n));
 }
 
 /// <summary>
@@ -351,74 +413,7507 @@ void testIsPrime() {
 }
 
 /// <summary>
-/// Titik masuk program yang menjalankan seluruh demonstrasi dan suite pengujian.
+/// Akar kuadrat bulat untuk bilangan 64-bit.
 /// </summary>
-/// <returns>Kode keluar proses (0 bila berhasil).</returns>
+/// <param name="n">Bilangan bulat tak bertanda.</param>
+/// <returns>Nilai r terbesar dengan r*r &lt;= n.</returns>
 /// <remarks>
-/// Bagian ini mengeksekusi tiap modul uji (1..10) dan menuliskan hasilnya ke stdout.
+/// Tebakan awal dari <c>std::sqrt</c> dikoreksi agar tepat di seluruh rentang 64-bit.
 /// </remarks>
-int main()
-{
-    std::cout << "1. Teori Himpunan\n";
+uint64_t isqrt64(uint64_t n) {
+    uint64_t r = static_cast<uint64_t>(std::sqrt(static_cast<double>(n)));
+    if (r > 0xFFFFFFFFull) r = 0xFFFFFFFFull;
+    while (r * r > n) --r;
+    while (r < 0xFFFFFFFFull && (r + 1) * (r + 1) <= n) ++r;
+    return r;
+}
 
-    std::vector<std::vector<bool>> featureCombinations = {
-        {true, true, false},
-        {true, false, true},
-        {false, true, true},
-        {true, true, true}
+/// <summary>
+/// Saringan Eratosthenes sederhana untuk menghasilkan prima penyaring.
+/// </summary>
+/// <param name="limit">Batas atas (inklusif).</param>
+/// <returns>Seluruh bilangan prima p dengan p &lt;= <paramref name="limit"/>, terurut naik.</returns>
+/// <remarks>
+/// Hanya bilangan ganjil yang disimpan sehingga memori sekitar limit/2 byte.
+/// </remarks>
+std::vector<uint32_t> simpleSieve(uint32_t limit) {
+    std::vector<uint32_t> primes;
+    if (limit < 2) return primes;
+    primes.push_back(2);
+    // Indeks i mewakili bilangan ganjil 2i+1.
+    std::vector<uint8_t> composite(limit / 2 + 1, 0);
+    for (uint64_t i = 1; i < composite.size(); ++i) {
+        if (composite[i]) continue;
+        uint64_t p = 2 * i + 1;
+        if (p > limit) break;
+        primes.push_back(static_cast<uint32_t>(p));
+        for (uint64_t j = p * p / 2; j < composite.size(); j += p) {
+            composite[j] = 1;
+        }
+    }
+    return primes;
+}
+
+/// <summary>
+/// Ukuran segmen bawaan (byte) untuk <see cref="BucketSieve"/>; satu byte mewakili satu bilangan ganjil.
+/// </summary>
+const uint32_t kDefaultSieveSegmentSize = 1u << 18;
+
+/// <summary>
+/// 11) Saringan bersegmen dengan bucket untuk prima penyaring besar (gaya primesieve).
+/// </summary>
+/// <remarks>
+/// Rentang tertutup [low, high] dipecah menjadi segmen berukuran tetap. Prima penyaring
+/// yang lebih kecil dari segmen dicoret seperti biasa, sedangkan prima besar (yang paling
+/// banyak satu kali mengenai sebuah segmen) disimpan dalam daftar bucket melingkar
+/// berdasarkan segmen berikutnya yang akan dikenainya. Dengan begitu setiap segmen hanya
+/// menyentuh prima yang benar-benar memotongnya, dan rentang di sekitar 10^15 tetap praktis.
+/// </remarks>
+/// <example>
+/// BucketSieve sieve(1000000000000ull, 1000000001000ull);
+/// std::vector&lt;uint64_t&gt; primes;
+/// while (sieve.nextSegment(primes)) { /* proses primes */ }
+/// </example>
+class BucketSieve {
+public:
+    /// <summary>Batas atas eksklusif untuk <c>high</c> agar aritmetika indeks tidak overflow.</summary>
+    static const uint64_t kMaxHigh = 1ull << 62;
+
+    /// <summary>
+    /// Menyiapkan saringan untuk rentang [low, high].
+    /// </summary>
+    /// <param name="low">Batas bawah (inklusif).</param>
+    /// <param name="high">Batas atas (inklusif), harus &lt; <see cref="kMaxHigh"/>.</param>
+    /// <param name="segmentSize">Jumlah bilangan ganjil per segmen (sebaiknya seukuran cache L2).</param>
+    /// <exception cref="std::invalid_argument">
+    /// Dilempar bila <paramref name="high"/> terlalu besar atau <paramref name="segmentSize"/> nol.
+    /// </exception>
+    BucketSieve(uint64_t low, uint64_t high, uint32_t segmentSize = kDefaultSieveSegmentSize)
+        : m_segmentSize(segmentSize) {
+        if (high >= kMaxHigh) {
+            throw std::invalid_argument("Batas atas saringan terlalu besar");
+        }
+        if (segmentSize == 0) {
+            throw std::invalid_argument("Ukuran segmen harus positif");
+        }
+        if (low > high) return;
+
+        m_emitTwo = (low <= 2 && 2 <= high);
+        if (high == 0) return;
+        // Indeks global i mewakili bilangan ganjil 2i+1.
+        uint64_t firstOdd = (low <= 1) ? 1 : (low | 1);
+        uint64_t lastOdd = (high % 2 == 1) ? high : high - 1;
+        if (firstOdd > lastOdd) return;
+        m_segmentBegin = firstOdd / 2;
+        m_endIndex = lastOdd / 2 + 1;
+        m_flags.resize(segmentSize);
+
+        std::vector<uint32_t> sievingPrimes = simpleSieve(static_cast<uint32_t>(isqrt64(high)));
+        uint32_t maxPrime = sievingPrimes.empty() ? 0 : sievingPrimes.back();
+        m_buckets.resize(maxPrime / segmentSize + 2);
+
+        for (uint32_t p : sievingPrimes) {
+            if (p == 2) continue;
+            uint64_t square = static_cast<uint64_t>(p) * p;
+            uint64_t start = (firstOdd + p - 1) / p * p;
+            if (start % 2 == 0) start += p;
+            if (start < square) start = square;
+            uint64_t startIndex = start / 2;
+
+            if (p < segmentSize) {
+                m_smallPrimes.push_back({ p, startIndex });
+            }
+            else if (square < firstOdd) {
+                // Kelipatan pertama berjarak kurang dari p indeks, jadi selalu muat di bucket.
+                uint64_t distance = startIndex - m_segmentBegin;
+                m_buckets[distance / segmentSize].push_back(
+                    { p, static_cast<uint32_t>(distance % segmentSize) });
+            }
+            else {
+                // Dimulai dari p*p; diaktifkan saat saringan mencapai segmen tersebut.
+                m_pendingPrimes.push_back({ p, startIndex });
+            }
+        }
+    }
+
+    /// <summary>
+    /// Menyaring segmen berikutnya dan menuliskan bilangan prima di dalamnya.
+    /// </summary>
+    /// <param name="primes">Vektor keluaran; dikosongkan lalu diisi prima segmen ini (terurut naik).</param>
+    /// <returns>False bila seluruh rentang sudah habis diproses.</returns>
+    bool nextSegment(std::vector<uint64_t>& primes) {
+        primes.clear();
+        if (m_emitTwo) {
+            primes.push_back(2);
+            m_emitTwo = false;
+        }
+        if (m_segmentBegin >= m_endIndex) return !primes.empty();
+
+        const uint32_t length = static_cast<uint32_t>(
+            std::min<uint64_t>(m_segmentSize, m_endIndex - m_segmentBegin));
+        const uint64_t segmentEnd = m_segmentBegin + length;
+        std::fill(m_flags.begin(), m_flags.begin() + length, uint8_t{ 1 });
+        if (m_segmentBegin == 0) m_flags[0] = 0; // bilangan 1 bukan prima
+
+        for (SmallSievingPrime& small : m_smallPrimes) {
+            uint64_t j = small.nextIndex;
+            for (; j < segmentEnd; j += small.prime) {
+                m_flags[j - m_segmentBegin] = 0;
+            }
+            small.nextIndex = j;
+        }
+
+        std::vector<BucketEntry>& bucket = m_buckets[m_segmentNumber % m_buckets.size()];
+        while (m_pendingPos < m_pendingPrimes.size() &&
+               m_pendingPrimes[m_pendingPos].nextIndex < segmentEnd) {
+            const SmallSievingPrime& pending = m_pendingPrimes[m_pendingPos++];
+            bucket.push_back({ pending.prime, static_cast<uint32_t>(pending.nextIndex - m_segmentBegin) });
+        }
+        for (const BucketEntry& entry : bucket) {
+            if (entry.offset < length) m_flags[entry.offset] = 0;
+            // Prima besar tidak mengenai segmen yang sama dua kali, jadi ahead >= 1.
+            uint64_t next = static_cast<uint64_t>(entry.offset) + entry.prime;
+            uint64_t ahead = next / m_segmentSize;
+            m_buckets[(m_segmentNumber + ahead) % m_buckets.size()].push_back(
+                { entry.prime, static_cast<uint32_t>(next % m_segmentSize) });
+        }
+        bucket.clear();
+
+        for (uint32_t j = 0; j < length; ++j) {
+            if (m_flags[j]) primes.push_back(2 * (m_segmentBegin + j) + 1);
+        }
+        m_segmentBegin = segmentEnd;
+        ++m_segmentNumber;
+        return true;
+    }
+
+private:
+    struct SmallSievingPrime {
+        uint32_t prime;
+        uint64_t nextIndex;
     };
 
-    for (const auto& combination : featureCombinations) {
-        testFeatureCombination(combination[0], combination[1], combination[2]);
+    struct BucketEntry {
+        uint32_t prime;
+        uint32_t offset;
+    };
+
+    uint32_t m_segmentSize;
+    bool m_emitTwo = false;
+    uint64_t m_segmentBegin = 0;
+    uint64_t m_endIndex = 0;
+    uint64_t m_segmentNumber = 0;
+    std::vector<uint8_t> m_flags;
+    std::vector<SmallSievingPrime> m_smallPrimes;
+    std::vector<SmallSievingPrime> m_pendingPrimes;
+    size_t m_pendingPos = 0;
+    std::vector<std::vector<BucketEntry>> m_buckets;
+};
+
+/// <summary>
+/// Mengumpulkan seluruh bilangan prima pada rentang tertutup [low, high] dengan <see cref="BucketSieve"/>.
+/// </summary>
+/// <param name="low">Batas bawah (inklusif).</param>
+/// <param name="high">Batas atas (inklusif).</param>
+/// <param name="segmentSize">Jumlah bilangan ganjil per segmen.</param>
+/// <returns>Bilangan prima terurut naik.</returns>
+std::vector<uint64_t> primesInRange(uint64_t low, uint64_t high,
+                                    uint32_t segmentSize = kDefaultSieveSegmentSize) {
+    BucketSieve sieve(low, high, segmentSize);
+    std::vector<uint64_t> result;
+    std::vector<uint64_t> segment;
+    while (sieve.nextSegment(segment)) {
+        result.insert(result.end(), segment.begin(), segment.end());
     }
+    return result;
+}
 
-    std::cout << "=======================\n";
-    std::cout << "2. Pengujian Kelas Equivalence\n";
+/// <summary>
+/// Menghitung banyaknya bilangan prima pada rentang tertutup [low, high] tanpa menyimpan semuanya.
+/// </summary>
+/// <param name="low">Batas bawah (inklusif).</param>
+/// <param name="high">Batas atas (inklusif).</param>
+/// <param name="segmentSize">Jumlah bilangan ganjil per segmen.</param>
+/// <returns>Jumlah bilangan prima di dalam rentang.</returns>
+uint64_t countPrimesInRange(uint64_t low, uint64_t high,
+                            uint32_t segmentSize = kDefaultSieveSegmentSize) {
+    BucketSieve sieve(low, high, segmentSize);
+    uint64_t count = 0;
+    std::vector<uint64_t> segment;
+    while (sieve.nextSegment(segment)) {
+        count += segment.size();
+    }
+    return count;
+}
 
-    testProcessValue();
+/// <summary>
+/// Kumpulan uji untuk <see cref="BucketSieve"/>: rentang kecil, jalur bucket, dan rentang di atas 10^12.
+/// </summary>
+void testBucketSieve() {
+    std::vector<uint64_t> small = primesInRange(0, 30);
+    assert((small == std::vector<uint64_t>{ 2, 3, 5, 7, 11, 13, 17, 19, 23, 29 }));
+    assert(primesInRange(2, 2) == std::vector<uint64_t>{ 2 });
+    assert(primesInRange(24, 28).empty());
+    assert(countPrimesInRange(0, 1000000) == 78498); // pi(10^6)
 
-    std::cout << "=======================\n";
-    std::cout << "3. Pengujian Keterjangkauan\n";
+    // Segmen kecil memaksa sebagian besar prima penyaring masuk ke bucket.
+    std::vector<uint64_t> bucketed = primesInRange(0, 20000, 16);
+    size_t next = 0;
+    for (int n = 0; n <= 20000; ++n) {
+        if (isPrime(n)) {
+            assert(next < bucketed.size() && bucketed[next] == static_cast<uint64_t>(n));
+            ++next;
+        }
+    }
+    assert(next == bucketed.size());
 
-    // Menguji semua jalur
-    process(10);
-    process(7);
-    process(-5);
+    // Di atas 10^12: jalur prima kecil dan jalur bucket harus sepakat.
+    const uint64_t trillion = 1000000000000ull;
+    std::vector<uint64_t> large = primesInRange(trillion, trillion + 200000);
+    assert(large.front() == 1000000000039ull); // prima 13 digit terkecil
+    assert(large == primesInRange(trillion, trillion + 200000, 64));
 
-    std::cout << "=======================\n";
-    std::cout << "4. Pengujian Batasan\n";
+    try {
+        BucketSieve tooLarge(0, BucketSieve::kMaxHigh);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
 
-    testCheckRange();
+    std::cout << "Semua uji saringan bucket lulus!\n";
+}
 
-    std::cout << "=======================\n";
-    std::cout << "5. Pengujian Kombinatorial\n";
+/// <summary>
+/// Menghitung banyaknya bit bernilai 1 pada kata 64-bit.
+/// </summary>
+/// <param name="x">Kata yang dihitung.</param>
+/// <returns>Jumlah bit 1 (0..64).</returns>
+/// <remarks>
+/// Memakai builtin kompilator bila ada; selain itu algoritma SWAR yang aman untuk
+/// CPU tanpa instruksi POPCNT.
+/// </remarks>
+inline unsigned popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<unsigned>((x * 0x0101010101010101ull) >> 56);
+#endif
+}
 
-    testEvaluationCombination();
+/// <summary>
+/// Memberi petunjuk ke CPU untuk memuat alamat ke cache sebelum dibaca.
+/// </summary>
+/// <param name="address">Alamat yang akan segera dibaca.</param>
+inline void prefetchRead(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 1);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
 
-    std::cout << "=======================\n";
-    std::cout << "6. Pengujian Pengurutan\n";
+/// <summary>
+/// 12) Indeks rank/select ringkas di atas bitmap bilangan prima untuk pi(x) dan prima ke-n.
+/// </summary>
+/// <remarks>
+/// Bitmap hanya menyimpan bilangan ganjil (bit i mewakili 2i+1). Setiap superblok 2048 bit
+/// memiliki satu entri 64-bit: 32 bit rank absolut ditambah tiga hitungan 10-bit untuk blok
+/// 512 bit pertama, sehingga rank cukup satu entri dan paling banyak tujuh popcount
+/// (overhead sekitar 3%). Select memakai sampel setiap <see cref="kSelectSampleRate"/>
+/// bit 1 untuk mempersempit pencarian superblok. Rank absolut 32-bit membatasi tabel
+/// hingga <see cref="kMaxLimit"/> (pi(10^11) = 4 118 054 813 &lt; 2^32).
+/// </remarks>
+class PrimeRankSelectIndex {
+public:
+    /// <summary>Jarak antar sampel select (dalam jumlah bilangan prima).</summary>
+    static const uint64_t kSelectSampleRate = 8192;
 
-    testIsSorted();
+    /// <summary>Batas tabel terbesar yang rank-nya masih muat di penghitung 32-bit.</summary>
+    static const uint64_t kMaxLimit = 100000000000ull;
 
-    std::cout << "=======================\n";
-    std::cout << "7. Diagram Venn\n";
+    /// <summary>
+    /// Menyaring seluruh bilangan prima &lt;= <paramref name="limit"/> lalu membangun indeks.
+    /// </summary>
+    /// <param name="limit">Batas atas tabel (inklusif), paling besar <see cref="kMaxLimit"/>.</param>
+    /// <exception cref="std::invalid_argument">Dilempar bila limit &gt; kMaxLimit.</exception>
+    explicit PrimeRankSelectIndex(uint64_t limit) : m_limit(limit) {
+        if (limit > kMaxLimit) {
+            throw std::invalid_argument("Batas tabel prima melebihi jangkauan rank 32-bit");
+        }
+        const uint64_t bitCount = limit / 2 + 1;
+        const uint64_t superblockCount = (bitCount + kSuperblockBits - 1) / kSuperblockBits;
+        m_words.assign(superblockCount * kWordsPerSuperblock, 0);
 
-    testClassifyNumber();
+        BucketSieve sieve(3, limit);
+        std::vector<uint64_t> segment;
+        while (sieve.nextSegment(segment)) {
+            for (uint64_t p : segment) {
+                uint64_t bit = p / 2;
+                m_words[bit / 64] |= 1ull << (bit % 64);
+            }
+        }
 
-    std::cout << "=======================\n";
-    std::cout << "8. Faktorial\n";
+        m_superblocks.resize(superblockCount + 1);
+        uint64_t rank = 0;
+        for (uint64_t s = 0; s < superblockCount; ++s) {
+            uint64_t entry = rank;
+            for (unsigned block = 0; block < kBlocksPerSuperblock; ++block) {
+                unsigned count = 0;
+                for (unsigned w = 0; w < kWordsPerBlock; ++w) {
+                    count += popcount64(m_words[(s * kBlocksPerSuperblock + block) * kWordsPerBlock + w]);
+                }
+                if (block < kBlocksPerSuperblock - 1) {
+                    entry |= static_cast<uint64_t>(count) << (32 + 10 * block);
+                }
+                for (uint64_t k = rank; k < rank + count; ++k) {
+                    if (k % kSelectSampleRate == 0) m_selectSamples.push_back(static_cast<uint32_t>(s));
+                }
+                rank += count;
+            }
+            m_superblocks[s] = entry;
+        }
+        assert(rank <= 0xFFFFFFFFull);
+        m_superblocks[superblockCount] = rank;
+        m_oddPrimeCount = rank;
+        m_selectSamples.push_back(static_cast<uint32_t>(superblockCount));
+    }
 
-    testFactorial();
+    /// <summary>Batas atas tabel yang dipakai saat konstruksi.</summary>
+    uint64_t limit() const { return m_limit; }
 
-    std::cout << "=======================\n";
-    std::cout << "9. Fibonacci\n";
+    /// <summary>
+    /// Fungsi penghitung prima pi(x): banyaknya prima &lt;= x, dalam waktu konstan.
+    /// </summary>
+    /// <param name="x">Nilai query, harus &lt;= <see cref="limit"/>.</param>
+    /// <returns>pi(x).</returns>
+    /// <exception cref="std::invalid_argument">Dilempar bila x di luar tabel.</exception>
+    uint64_t primeCount(uint64_t x) const {
+        if (x > m_limit) {
+            throw std::invalid_argument("Query di luar jangkauan tabel prima");
+        }
+        if (x < 2) return 0;
+        return 1 + rank((x - 1) / 2 + 1);
+    }
 
-    testFibonacci();
+    /// <summary>
+    /// Prima ke-n (berbasis 1: nthPrime(1) == 2).
+    /// </summary>
+    /// <param name="n">Urutan prima, 1 &lt;= n &lt;= pi(limit).</param>
+    /// <returns>Bilangan prima ke-n.</returns>
+    /// <exception cref="std::invalid_argument">Dilempar bila n di luar tabel.</exception>
+    uint64_t nthPrime(uint64_t n) const {
+        if (n == 0 || n > totalPrimes()) {
+            throw std::invalid_argument("Urutan prima di luar jangkauan tabel");
+        }
+        if (n == 1) return 2;
+        return 2 * select(n - 2) + 1;
+    }
 
-    std::cout << "=======================\n";
-    std::cout << "10. Bilangan Prima\n";
+    /// <summary>Jumlah seluruh prima di dalam tabel, yaitu pi(limit).</summary>
+    uint64_t totalPrimes() const { return m_limit < 2 ? 0 : m_oddPrimeCount + 1; }
 
-    testIsPrime();
+    /// <summary>
+    /// Bentuk batch dari <see cref="primeCount"/> dengan prefetch beberapa query ke depan
+    /// agar cache miss antar query saling tumpang tindih.
+    /// </summary>
+    /// <param name="queries">Nilai-nilai x.</param>
+    /// <returns>pi(x) untuk setiap query, urutan sama dengan input.</returns>
+    std::vector<uint64_t> primeCountBatch(const std::vector<uint64_t>& queries) const {
+        const size_t distance = 8;
+        std::vector<uint64_t> result(queries.size());
+        for (size_t i = 0; i < queries.size(); ++i) {
+            if (i + distance < queries.size() && queries[i + distance] <= m_limit) {
+                uint64_t bit = queries[i + distance] / 2;
+                prefetchRead(&m_superblocks[bit / kSuperblockBits]);
+                prefetchRead(&m_words[bit / 64]);
+            }
+            result[i] = primeCount(queries[i]);
+        }
+        return result;
+    }
+
+    /// <summary>Rasio ukuran indeks (superblok + sampel select) terhadap ukuran bitmap.</summary>
+    double overhead() const {
+        double indexBytes = m_superblocks.size() * sizeof(uint64_t) + m_selectSamples.size() * sizeof(uint32_t);
+        return indexBytes / (m_words.size() * sizeof(uint64_t));
+    }
+
+private:
+    static const uint64_t kWordsPerBlock = 8;
+    static const uint64_t kBlocksPerSuperblock = 4;
+    static const uint64_t kWordsPerSuperblock = kWordsPerBlock * kBlocksPerSuperblock;
+    static const uint64_t kSuperblockBits = kWordsPerSuperblock * 64;
+
+    /// <summary>Banyaknya bit 1 pada posisi [0, position).</summary>
+    uint64_t rank(uint64_t position) const {
+        const uint64_t superblock = position / kSuperblockBits;
+        const uint64_t entry = m_superblocks[superblock];
+        uint64_t result = entry & 0xFFFFFFFFull;
+        const unsigned block = static_cast<unsigned>(position / (kWordsPerBlock * 64) % kBlocksPerSuperblock);
+        for (unsigned b = 0; b < block; ++b) {
+            result += (entry >> (32 + 10 * b)) & 0x3FF;
+        }
+        uint64_t word = superblock * kWordsPerSuperblock + block * kWordsPerBlock;
+        for (; word < position / 64; ++word) {
+            result += popcount64(m_words[word]);
+        }
+        if (position % 64 != 0) {
+            result += popcount64(m_words[word] & ((1ull << (position % 64)) - 1));
+        }
+        return result;
+    }
+
+    /// <summary>Posisi bit 1 ke-k (berbasis 0).</summary>
+    uint64_t select(uint64_t k) const {
+        // Sampel membatasi superblok kandidat; sisanya dicari biner pada rank absolut.
+        uint64_t lo = m_selectSamples[k / kSelectSampleRate];
+        uint64_t hi = m_selectSamples[k / kSelectSampleRate + 1];
+        while (lo < hi) {
+            uint64_t mid = lo + (hi - lo + 1) / 2;
+            if ((m_superblocks[mid] & 0xFFFFFFFFull) <= k) lo = mid;
+            else hi = mid - 1;
+        }
+        const uint64_t entry = m_superblocks[lo];
+        uint64_t remaining = k - (entry & 0xFFFFFFFFull);
+        uint64_t word = lo * kWordsPerSuperblock;
+        for (unsigned b = 0; b < kBlocksPerSuperblock - 1; ++b) {
+            uint64_t count = (entry >> (32 + 10 * b)) & 0x3FF;
+            if (remaining < count) break;
+            remaining -= count;
+            word += kWordsPerBlock;
+        }
+        for (;; ++word) {
+            unsigned count = popcount64(m_words[word]);
+            if (remaining < count) break;
+            remaining -= count;
+        }
+        uint64_t bits = m_words[word];
+        for (unsigned bit = 0; bit < 64; bit += 8) {
+            unsigned count = popcount64((bits >> bit) & 0xFF);
+            if (remaining < count) {
+                for (;; ++bit) {
+                    if ((bits >> bit) & 1) {
+                        if (remaining == 0) return word * 64 + bit;
+                        --remaining;
+                    }
+                }
+            }
+            remaining -= count;
+        }
+        return word * 64; // tidak tercapai untuk k yang valid
+    }
+
+    uint64_t m_limit;
+    uint64_t m_oddPrimeCount = 0;
+    std::vector<uint64_t> m_words;
+    std::vector<uint64_t> m_superblocks;
+    std::vector<uint32_t> m_selectSamples;
+};
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="PrimeRankSelectIndex"/>: pi(x), prima ke-n, batch, dan overhead.
+/// </summary>
+void testPrimeRankSelectIndex() {
+    PrimeRankSelectIndex index(2000000);
+    assert(index.primeCount(0) == 0);
+    assert(index.primeCount(1) == 0);
+    assert(index.primeCount(2) == 1);
+    assert(index.primeCount(100) == 25);
+    assert(index.primeCount(1000000) == 78498);
+    assert(index.totalPrimes() == 148933); // pi(2 * 10^6)
+    assert(index.nthPrime(1) == 2);
+    assert(index.nthPrime(25) == 97);
+    assert(index.nthPrime(78498) == 999983);
+    assert(index.nthPrime(index.totalPrimes()) == 1999993);
+
+    // Bandingkan dengan isPrime pada seluruh rentang kecil.
+    uint64_t count = 0;
+    for (int x = 0; x <= 50000; ++x) {
+        if (isPrime(x)) {
+            ++count;
+            assert(index.nthPrime(count) == static_cast<uint64_t>(x));
+        }
+        assert(index.primeCount(x) == count);
+    }
+
+    std::vector<uint64_t> queries = { 1999999, 10, 0, 7919, 104729, 2000000 };
+    std::vector<uint64_t> expected = { 148933, 4, 0, 1000, 10000, 148933 };
+    assert(index.primeCountBatch(queries) == expected);
+    assert(index.overhead() < 0.04);
+
+    try {
+        index.primeCount(2000001);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    try {
+        PrimeRankSelectIndex tooLarge(PrimeRankSelectIndex::kMaxLimit + 1);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji indeks rank/select lulus!\n";
+}
+
+/// <summary>
+/// Menjalankan <paramref name="body"/>(i) untuk setiap i di [0, count) secara paralel.
+/// </summary>
+/// <param name="count">Jumlah tugas.</param>
+/// <param name="threadCount">Jumlah thread; 0 berarti <c>std::thread::hardware_concurrency()</c>.</param>
+/// <param name="body">Fungsi tugas; dipanggil bersamaan dari beberapa thread.</param>
+/// <remarks>
+/// Penjadwalan dinamis lewat penghitung atomik sehingga tugas yang lambat tidak menahan thread lain.
+/// Exception pertama dari tugas dilempar ulang di thread pemanggil setelah semua thread selesai.
+/// </remarks>
+template <typename Body>
+void parallelFor(size_t count, unsigned threadCount, Body&& body) {
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    if (threadCount > count) threadCount = static_cast<unsigned>(std::max<size_t>(count, 1));
+
+    std::atomic<size_t> next(0);
+    std::exception_ptr failure;
+    std::mutex failureMutex;
+    auto worker = [&]() {
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            try {
+                body(i);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (!failure) failure = std::current_exception();
+                next.store(count);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < threadCount; ++t) threads.emplace_back(worker);
+    worker();
+    for (std::thread& thread : threads) thread.join();
+    if (failure) std::rethrow_exception(failure);
+}
+
+/// <summary>
+/// 13) Tabel faktor prima terkecil (smallest prime factor) dari saringan linear (Euler).
+/// </summary>
+/// <remarks>
+/// Setiap bilangan komposit dicoret tepat satu kali oleh faktor prima terkecilnya, sehingga
+/// konstruksi O(N). Hanya bilangan ganjil yang disimpan (faktor terkecil bilangan genap
+/// selalu 2), jadi memori sekitar 2N byte.
+/// </remarks>
+class SmallestPrimeFactorTable {
+public:
+    /// <summary>Membangun tabel untuk 1..<paramref name="limit"/>.</summary>
+    /// <param name="limit">Batas atas (inklusif), &lt; 2^32.</param>
+    explicit SmallestPrimeFactorTable(uint32_t limit) : m_limit(limit), m_odd(limit / 2 + 1, 0) {
+        if (limit >= 2) m_primes.push_back(2);
+        for (uint64_t n = 3; n <= limit; n += 2) {
+            uint32_t& spf = m_odd[n / 2];
+            if (spf == 0) {
+                spf = static_cast<uint32_t>(n);
+                m_primes.push_back(spf);
+            }
+            // Lewati 2: kelipatan genap tidak disimpan.
+            for (size_t i = 1; i < m_primes.size() && m_primes[i] <= spf; ++i) {
+                uint64_t multiple = n * m_primes[i];
+                if (multiple > limit) break;
+                m_odd[multiple / 2] = m_primes[i];
+            }
+        }
+    }
+
+    /// <summary>Faktor prima terkecil dari n (2 &lt;= n &lt;= limit).</summary>
+    /// <exception cref="std::invalid_argument">Dilempar bila n di luar tabel.</exception>
+    uint32_t smallestPrimeFactor(uint32_t n) const {
+        if (n < 2 || n > m_limit) {
+            throw std::invalid_argument("Nilai di luar tabel faktor prima");
+        }
+        return n % 2 == 0 ? 2 : m_odd[n / 2];
+    }
+
+    /// <summary>Faktorisasi prima n sebagai pasangan (prima, pangkat) terurut naik.</summary>
+    std::vector<std::pair<uint32_t, unsigned>> factorize(uint32_t n) const {
+        std::vector<std::pair<uint32_t, unsigned>> factors;
+        while (n > 1) {
+            uint32_t p = smallestPrimeFactor(n);
+            unsigned exponent = 0;
+            while (n % p == 0) {
+                n /= p;
+                ++exponent;
+            }
+            factors.emplace_back(p, exponent);
+        }
+        return factors;
+    }
+
+    /// <summary>Seluruh bilangan prima &lt;= limit, hasil sampingan saringan.</summary>
+    const std::vector<uint32_t>& primes() const { return m_primes; }
+
+private:
+    uint32_t m_limit;
+    std::vector<uint32_t> m_odd;
+    std::vector<uint32_t> m_primes;
+};
+
+/// <summary>
+/// Nilai fungsi multiplikatif untuk satu segmen [begin, begin + size()).
+/// </summary>
+/// <remarks>
+/// Disusun sebagai struct-of-arrays: phi(n) Euler, mu(n) Moebius, d(n) banyak pembagi,
+/// dan sigma(n) jumlah pembagi; elemen ke-i milik bilangan begin + i.
+/// </remarks>
+struct MultiplicativeSegment {
+    uint64_t begin = 1;
+    std::vector<uint64_t> phi;
+    std::vector<int8_t> mu;
+    std::vector<uint32_t> divisorCount;
+    std::vector<uint64_t> divisorSum;
+
+    size_t size() const { return phi.size(); }
+};
+
+/// <summary>
+/// Menghitung phi, mu, d, dan sigma untuk seluruh n di [1, limit] per segmen secara paralel.
+/// </summary>
+/// <param name="limit">Batas atas (inklusif); N = 10^9 tetap muat karena memori per segmen.</param>
+/// <param name="segmentSize">Banyak bilangan per segmen.</param>
+/// <param name="threadCount">Jumlah thread; 0 berarti sesuai perangkat keras.</param>
+/// <param name="callback">
+/// Dipanggil sekali per segmen dengan <see cref="MultiplicativeSegment"/>; dapat dipanggil
+/// bersamaan dari beberapa thread dan urutan segmen tidak dijamin.
+/// </param>
+/// <remarks>
+/// Setiap segmen memfaktorkan bilangannya dengan prima &lt;= sqrt(limit); sisa &gt; 1 setelah
+/// itu pasti prima tunggal. Penyimpanan segmen lokal per tugas, sehingga memori total
+/// O(sqrt(N) + thread * segmentSize).
+/// </remarks>
+template <typename Callback>
+void forEachMultiplicativeSegment(uint64_t limit, uint64_t segmentSize, unsigned threadCount,
+                                  Callback&& callback) {
+    if (segmentSize == 0) {
+        throw std::invalid_argument("Ukuran segmen harus positif");
+    }
+    if (limit == 0) return;
+    const std::vector<uint32_t> primes = simpleSieve(static_cast<uint32_t>(isqrt64(limit)));
+    const size_t segmentCount = static_cast<size_t>((limit + segmentSize - 1) / segmentSize);
+
+    parallelFor(segmentCount, threadCount, [&](size_t index) {
+        MultiplicativeSegment segment;
+        segment.begin = 1 + index * segmentSize;
+        const size_t size = static_cast<size_t>(std::min(segmentSize, limit - segment.begin + 1));
+        segment.phi.assign(size, 1);
+        segment.mu.assign(size, 1);
+        segment.divisorCount.assign(size, 1);
+        segment.divisorSum.assign(size, 1);
+        std::vector<uint64_t> remaining(size);
+        for (size_t i = 0; i < size; ++i) remaining[i] = segment.begin + i;
+
+        const uint64_t end = segment.begin + size;
+        for (uint32_t p : primes) {
+            if (static_cast<uint64_t>(p) * p >= end) break;
+            uint64_t first = (segment.begin + p - 1) / p * p;
+            for (uint64_t n = first; n < end; n += p) {
+                const size_t i = static_cast<size_t>(n - segment.begin);
+                unsigned exponent = 0;
+                uint64_t power = 1;
+                do {
+                    remaining[i] /= p;
+                    power *= p;
+                    ++exponent;
+                } while (remaining[i] % p == 0);
+                segment.phi[i] *= power - power / p;
+                segment.mu[i] = exponent > 1 ? 0 : static_cast<int8_t>(-segment.mu[i]);
+                segment.divisorCount[i] *= exponent + 1;
+                segment.divisorSum[i] *= (power * p - 1) / (p - 1);
+            }
+        }
+        for (size_t i = 0; i < size; ++i) {
+            uint64_t q = remaining[i];
+            if (q > 1) {
+                segment.phi[i] *= q - 1;
+                segment.mu[i] = static_cast<int8_t>(-segment.mu[i]);
+                segment.divisorCount[i] *= 2;
+                segment.divisorSum[i] *= q + 1;
+            }
+        }
+        callback(static_cast<const MultiplicativeSegment&>(segment));
+    });
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="SmallestPrimeFactorTable"/> dan <see cref="forEachMultiplicativeSegment"/>.
+/// </summary>
+void testMultiplicativeFunctions() {
+    SmallestPrimeFactorTable table(100000);
+    assert(table.primes().size() == 9592); // pi(10^5)
+    for (uint32_t n = 2; n <= 20000; ++n) {
+        uint32_t expected = 2;
+        while (n % expected != 0) ++expected;
+        assert(table.smallestPrimeFactor(n) == expected);
+    }
+    std::vector<std::pair<uint32_t, unsigned>> factors = table.factorize(360);
+    assert((factors == std::vector<std::pair<uint32_t, unsigned>>{ {2, 3}, {3, 2}, {5, 1} }));
+
+    // Segmen berukuran ganjil dan beberapa thread dibandingkan dengan perhitungan langsung.
+    const uint64_t limit = 1000;
+    std::vector<uint64_t> phi(limit + 1), sigma(limit + 1);
+    std::vector<int> mu(limit + 1);
+    std::vector<uint32_t> divisors(limit + 1);
+    std::mutex resultMutex;
+    forEachMultiplicativeSegment(limit, 97, 3, [&](const MultiplicativeSegment& segment) {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        for (size_t i = 0; i < segment.size(); ++i) {
+            uint64_t n = segment.begin + i;
+            phi[n] = segment.phi[i];
+            mu[n] = segment.mu[i];
+            divisors[n] = segment.divisorCount[i];
+            sigma[n] = segment.divisorSum[i];
+        }
+    });
+    for (uint64_t n = 1; n <= limit; ++n) {
+        uint64_t expectedPhi = 0, expectedSigma = 0;
+        uint32_t expectedDivisors = 0;
+        for (uint64_t k = 1; k <= n; ++k) {
+            uint64_t a = k, b = n;
+            while (b != 0) { uint64_t t = a % b; a = b; b = t; }
+            if (a == 1) ++expectedPhi;
+            if (n % k == 0) { ++expectedDivisors; expectedSigma += k; }
+        }
+        int expectedMu = 1;
+        uint64_t rest = n;
+        for (uint64_t p = 2; p <= rest; ++p) {
+            if (rest % p != 0) continue;
+            rest /= p;
+            expectedMu = (rest % p == 0) ? 0 : -expectedMu;
+            while (rest % p == 0) rest /= p;
+        }
+        assert(phi[n] == expectedPhi);
+        assert(mu[n] == expectedMu);
+        assert(divisors[n] == expectedDivisors);
+        assert(sigma[n] == expectedSigma);
+    }
+
+    // Jumlah phi dan fungsi Mertens hingga 10^6.
+    std::atomic<uint64_t> phiSum(0);
+    std::atomic<int64_t> mertens(0);
+    forEachMultiplicativeSegment(1000000, 1 << 15, 0, [&](const MultiplicativeSegment& segment) {
+        uint64_t localPhi = 0;
+        int64_t localMu = 0;
+        for (size_t i = 0; i < segment.size(); ++i) {
+            localPhi += segment.phi[i];
+            localMu += segment.mu[i];
+        }
+        phiSum += localPhi;
+        mertens += localMu;
+    });
+    assert(phiSum == 303963552392ull);
+    assert(mertens == 212);
+
+    std::cout << "Semua uji fungsi multiplikatif lulus!\n";
+}
+
+/// <summary>
+/// Uji keterbagian dengan pembagi invarian (gaya libdivide) untuk satu prima ganjil p.
+/// </summary>
+/// <remarks>
+/// Karena p ganjil, p punya invers modulo 2^64. n habis dibagi p tepat bila
+/// n * inverse (mod 2^64) &lt;= floor((2^64 - 1) / p), sehingga operasi % cukup diganti
+/// satu perkalian dan satu perbandingan. Versi 32-bit dipakai oleh kernel batch.
+/// </remarks>
+struct DivisibilityTest {
+    uint64_t inverse;
+    uint64_t limit;
+    uint32_t inverse32;
+    uint32_t limit32;
+    uint32_t prime;
+};
+
+/// <summary>
+/// Membuat <see cref="DivisibilityTest"/> untuk prima ganjil p.
+/// </summary>
+/// <param name="p">Pembagi ganjil.</param>
+/// <returns>Invers modular dan batas untuk 64-bit dan 32-bit.</returns>
+/// <remarks>Invers dihitung dengan iterasi Newton: tiap langkah menggandakan jumlah bit yang benar.</remarks>
+DivisibilityTest makeDivisibilityTest(uint32_t p) {
+    uint64_t inverse = p; // benar untuk 3 bit terbawah
+    for (int i = 0; i < 5; ++i) {
+        inverse *= 2 - p * inverse;
+    }
+    DivisibilityTest test;
+    test.inverse = inverse;
+    test.limit = UINT64_MAX / p;
+    test.inverse32 = static_cast<uint32_t>(inverse);
+    test.limit32 = UINT32_MAX / p;
+    test.prime = p;
+    return test;
+}
+
+/// <summary>True bila <paramref name="n"/> habis dibagi prima pada <paramref name="test"/>.</summary>
+inline bool isDivisible(uint64_t n, const DivisibilityTest& test) {
+    return n * test.inverse <= test.limit;
+}
+
+/// <summary>
+/// Tabel uji keterbagian untuk seluruh prima ganjil &lt; 2^16 (6541 prima).
+/// </summary>
+/// <returns>Tabel terurut naik menurut prima; dibangun sekali dan aman dipakai lintas thread.</returns>
+/// <remarks>Cukup untuk membuktikan keprimaan semua bilangan 32-bit dengan pembagian percobaan.</remarks>
+const std::vector<DivisibilityTest>& trialDivisionTable() {
+    static const std::vector<DivisibilityTest> table = [] {
+        std::vector<DivisibilityTest> tests;
+        for (uint32_t p : simpleSieve(65535)) {
+            if (p != 2) tests.push_back(makeDivisibilityTest(p));
+        }
+        return tests;
+    }();
+    return table;
+}
+
+/// <summary>
+/// Hasil pra-filter pembagian percobaan.
+/// </summary>
+/// <remarks>
+/// <see cref="TrialDivisionResult::Unknown"/> berarti tidak ada faktor kecil ditemukan tetapi
+/// n terlalu besar untuk dibuktikan prima; lanjutkan dengan uji yang lebih kuat.
+/// </remarks>
+enum class TrialDivisionResult { Composite, Prime, Unknown };
+
+/// <summary>
+/// 14) Pra-filter pembagian percobaan dengan pembagi invarian di depan uji keprimaan yang lebih kuat.
+/// </summary>
+/// <param name="n">Bilangan yang diuji.</param>
+/// <param name="primeCount">Banyak prima ganjil dari tabel yang dicoba (maksimum ukuran tabel).</param>
+/// <returns>
+/// <see cref="TrialDivisionResult::Composite"/> bila ditemukan faktor,
+/// <see cref="TrialDivisionResult::Prime"/> bila semua prima hingga sqrt(n) sudah dicoba,
+/// selain itu <see cref="TrialDivisionResult::Unknown"/>.
+/// </returns>
+/// <example>
+/// trialDivisionPrefilter(91)  // Composite (7 * 13)
+/// </example>
+TrialDivisionResult trialDivisionPrefilter(uint64_t n, size_t primeCount = SIZE_MAX) {
+    if (n < 2) return TrialDivisionResult::Composite;
+    if (n % 2 == 0) return n == 2 ? TrialDivisionResult::Prime : TrialDivisionResult::Composite;
+    const std::vector<DivisibilityTest>& table = trialDivisionTable();
+    const size_t count = std::min(primeCount, table.size());
+    for (size_t i = 0; i < count; ++i) {
+        const DivisibilityTest& test = table[i];
+        if (static_cast<uint64_t>(test.prime) * test.prime > n) return TrialDivisionResult::Prime;
+        if (isDivisible(n, test)) {
+            return n == test.prime ? TrialDivisionResult::Prime : TrialDivisionResult::Composite;
+        }
+    }
+    if (count == table.size() && n < 65536ull * 65536ull) return TrialDivisionResult::Prime;
+    return TrialDivisionResult::Unknown;
+}
+
+/// <summary>
+/// Keprimaan bilangan 32-bit sepenuhnya dengan pembagian percobaan berpembagi invarian.
+/// </summary>
+/// <param name="n">Bilangan tak bertanda 32-bit.</param>
+/// <returns>True jika prima.</returns>
+bool isPrimeByTrialDivision(uint32_t n) {
+    return trialDivisionPrefilter(n) == TrialDivisionResult::Prime;
+}
+
+/// <summary>
+/// Bentuk batch (ramah SIMD) pra-filter: menandai nilai yang punya faktor prima kecil.
+/// </summary>
+/// <param name="values">Nilai 32-bit yang diuji.</param>
+/// <param name="count">Jumlah nilai.</param>
+/// <param name="primeCount">Banyak prima ganjil pertama dari tabel yang dicoba.</param>
+/// <param name="hasSmallFactor">Keluaran: 1 bila nilai habis dibagi salah satu prima tersebut (selain dirinya sendiri).</param>
+/// <remarks>
+/// Loop dalam hanya berisi perkalian 32-bit, perbandingan, dan OR tanpa percabangan,
+/// sehingga divektorisasi otomatis oleh kompilator; nilai diproses per blok agar tetap di L1.
+/// </remarks>
+void smallFactorFilterBatch(const uint32_t* values, size_t count, size_t primeCount, uint8_t* hasSmallFactor) {
+    const std::vector<DivisibilityTest>& table = trialDivisionTable();
+    primeCount = std::min(primeCount, table.size());
+    const size_t blockSize = 1024;
+    for (size_t begin = 0; begin < count; begin += blockSize) {
+        const size_t end = std::min(count, begin + blockSize);
+        for (size_t i = begin; i < end; ++i) {
+            hasSmallFactor[i] = static_cast<uint8_t>((values[i] % 2 == 0) & (values[i] != 2));
+        }
+        for (size_t t = 0; t < primeCount; ++t) {
+            const uint32_t inverse = table[t].inverse32;
+            const uint32_t limit = table[t].limit32;
+            const uint32_t prime = table[t].prime;
+            for (size_t i = begin; i < end; ++i) {
+                hasSmallFactor[i] |= static_cast<uint8_t>(
+                    (static_cast<uint32_t>(values[i] * inverse) <= limit) & (values[i] != prime));
+            }
+        }
+    }
+}
+
+/// <summary>
+/// Kumpulan uji untuk uji keterbagian invarian, pra-filter, dan bentuk batch-nya.
+/// </summary>
+void testTrialDivision() {
+    const std::vector<DivisibilityTest>& table = trialDivisionTable();
+    assert(table.size() == 6541);
+    assert(table.front().prime == 3 && table.back().prime == 65521);
+    for (size_t t = 0; t < 50; ++t) {
+        for (uint64_t n = 0; n < 5000; ++n) {
+            assert(isDivisible(n, table[t]) == (n % table[t].prime == 0));
+        }
+    }
+    assert(isDivisible(3ull * 6148914691236517205ull, table[0])); // 2^64 - 1
+
+    assert(trialDivisionPrefilter(0) == TrialDivisionResult::Composite);
+    assert(trialDivisionPrefilter(2) == TrialDivisionResult::Prime);
+    assert(trialDivisionPrefilter(91) == TrialDivisionResult::Composite);
+    assert(trialDivisionPrefilter(65521) == TrialDivisionResult::Prime);
+    assert(trialDivisionPrefilter(4294967291ull) == TrialDivisionResult::Prime); // prima 32-bit terbesar
+    assert(trialDivisionPrefilter(1000003ull * 65521ull) == TrialDivisionResult::Composite);
+    assert(trialDivisionPrefilter(1000000000039ull) == TrialDivisionResult::Unknown);
+    assert(trialDivisionPrefilter(1000000000039ull, 10) == TrialDivisionResult::Unknown);
+
+    // isPrime kini memakai tabel; bandingkan dengan langkah 6k+/-1 yang lama.
+    auto reference = [](int n) {
+        if (n <= 1) return false;
+        if (n <= 3) return true;
+        if (n % 2 == 0 || n % 3 == 0) return false;
+        for (int i = 5; i * i <= n; i += 6) {
+            if (n % i == 0 || n % (i + 2) == 0) return false;
+        }
+        return true;
+    };
+    for (int n = -10; n <= 100000; ++n) {
+        assert(isPrime(n) == reference(n));
+    }
+    assert(isPrime(2147483647) == true);
+
+    std::vector<uint32_t> values;
+    for (uint32_t n = 1; n <= 3000; ++n) values.push_back(n * 7919u + 1);
+    std::vector<uint8_t> flags(values.size());
+    smallFactorFilterBatch(values.data(), values.size(), 100, flags.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        bool expected = trialDivisionPrefilter(values[i], 100) == TrialDivisionResult::Composite;
+        assert((flags[i] != 0) == expected);
+    }
+
+    std::cout << "Semua uji pembagian percobaan lulus!\n";
+}
+
+/// <summary>
+/// Perkalian modular 64-bit: (a * b) mod m tanpa overflow.
+/// </summary>
+/// <param name="a">Faktor pertama, &lt; m.</param>
+/// <param name="b">Faktor kedua, &lt; m.</param>
+/// <param name="m">Modulus, &gt; 0.</param>
+/// <returns>(a * b) mod m.</returns>
+/// <remarks>
+/// Memakai hasil kali 128-bit bila tersedia (GCC/Clang, atau MSVC x64); selain itu
+/// jatuh ke metode gandakan-dan-tambah yang lebih lambat.
+/// </remarks>
+inline uint64_t mulMod64(uint64_t a, uint64_t b, uint64_t m) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<uint64_t>(static_cast<unsigned __int128>(a) * b % m);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t high;
+    uint64_t low = _umul128(a, b, &high);
+    uint64_t remainder;
+    _udiv128(high, low, m, &remainder);
+    return remainder;
+#else
+    uint64_t result = 0;
+    while (b != 0) {
+        if (b & 1) result = (result >= m - a) ? result - (m - a) : result + a;
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
+/// <summary>
+/// Perpangkatan modular 64-bit dengan metode kuadrat-dan-kali.
+/// </summary>
+/// <param name="base">Basis.</param>
+/// <param name="exponent">Eksponen.</param>
+/// <param name="m">Modulus, &gt; 0.</param>
+/// <returns>base^exponent mod m.</returns>
+uint64_t powMod64(uint64_t base, uint64_t exponent, uint64_t m) {
+    uint64_t result = 1 % m;
+    base %= m;
+    while (exponent != 0) {
+        if (exponent & 1) result = mulMod64(result, base, m);
+        base = mulMod64(base, base, m);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+bool millerRabin64(uint64_t n);
+
+/// <summary>
+/// Uji keprimaan cepat untuk bilangan 64-bit: pra-filter prima kecil lalu Miller-Rabin.
+/// </summary>
+/// <param name="n">Bilangan yang diuji.</param>
+/// <returns>True jika n prima.</returns>
+bool isPrime64(uint64_t n) {
+    TrialDivisionResult quick = trialDivisionPrefilter(n, 16);
+    if (quick != TrialDivisionResult::Unknown) return quick == TrialDivisionResult::Prime;
+    return millerRabin64(n);
+}
+
+/// <summary>Prima 64-bit terbesar (2^64 - 59).</summary>
+const uint64_t kLargestPrime64 = 18446744073709551557ull;
+
+/// <summary>
+/// Banyak prima kecil yang dipakai menyaring jendela bila sqrt(high) melampaui tabel pembagi.
+/// </summary>
+const size_t kWindowSievePrimes = 512;
+
+/// <summary>
+/// 15) Seluruh bilangan prima pada jendela kecil [low, high] dengan saringan prima kecil dan konfirmasi 64-bit.
+/// </summary>
+/// <param name="low">Batas bawah (inklusif).</param>
+/// <param name="high">Batas atas (inklusif).</param>
+/// <returns>Bilangan prima terurut naik.</returns>
+/// <remarks>
+/// Kelipatan prima kecil dari tabel pembagi invarian dicoret dahulu. Bila seluruh prima
+/// hingga sqrt(high) ada di tabel, sisa saringan pasti prima; jika tidak, hanya
+/// <see cref="kWindowSievePrimes"/> prima pertama yang dipakai dan sisanya dikonfirmasi
+/// dengan <see cref="millerRabin64"/>. Cocok untuk jendela selebar ribuan, bukan rentang raksasa.
+/// </remarks>
+std::vector<uint64_t> primesInWindow(uint64_t low, uint64_t high) {
+    std::vector<uint64_t> primes;
+    if (low > high) return primes;
+    if (low <= 2 && 2 <= high) primes.push_back(2);
+    uint64_t firstOdd = (low <= 3) ? 3 : (low | 1);
+    if (firstOdd < low || firstOdd > high) return primes; // juga menangani overflow di 2^64 - 1
+    const uint64_t count = (high - firstOdd) / 2 + 1;
+    std::vector<uint8_t> candidate(static_cast<size_t>(count), 1);
+
+    const uint64_t sqrtHigh = isqrt64(high);
+    const bool fullySieved = sqrtHigh < 65537;
+    const std::vector<DivisibilityTest>& table = trialDivisionTable();
+    const size_t primeLimit = fullySieved ? table.size() : kWindowSievePrimes;
+    for (size_t t = 0; t < primeLimit; ++t) {
+        const uint64_t p = table[t].prime;
+        if (p > sqrtHigh) break;
+        // Indeks j mewakili firstOdd + 2j; cari j terkecil yang merupakan kelipatan p.
+        uint64_t j;
+        if (p * p >= firstOdd) {
+            j = (p * p - firstOdd) / 2;
+        }
+        else {
+            uint64_t r = firstOdd % p;
+            j = (p - r) % p * ((p + 1) / 2) % p;
+        }
+        for (; j < count; j += p) {
+            candidate[static_cast<size_t>(j)] = 0;
+        }
+    }
+    for (uint64_t j = 0; j < count; ++j) {
+        if (!candidate[static_cast<size_t>(j)]) continue;
+        uint64_t n = firstOdd + 2 * j;
+        if (fullySieved || millerRabin64(n)) primes.push_back(n);
+    }
+    return primes;
+}
+
+/// <summary>
+/// Bilangan prima terkecil yang &gt;= x (misalnya untuk ukuran tabel hash atau jumlah shard).
+/// </summary>
+/// <param name="x">Nilai awal.</param>
+/// <returns>Prima terkecil &gt;= x.</returns>
+/// <exception cref="std::overflow_error">Dilempar bila tidak ada prima 64-bit &gt;= x.</exception>
+uint64_t nextPrime(uint64_t x) {
+    if (x > kLargestPrime64) {
+        throw std::overflow_error("Tidak ada prima 64-bit setelah nilai ini");
+    }
+    const uint64_t window = 512;
+    for (uint64_t low = x;; low += window) {
+        uint64_t high = (low > UINT64_MAX - window) ? UINT64_MAX : low + window - 1;
+        std::vector<uint64_t> primes = primesInWindow(low, high);
+        if (!primes.empty()) return primes.front();
+    }
+}
+
+/// <summary>
+/// Bilangan prima terbesar yang &lt;= x.
+/// </summary>
+/// <param name="x">Nilai awal.</param>
+/// <returns>Prima terbesar &lt;= x.</returns>
+/// <exception cref="std::invalid_argument">Dilempar bila x &lt; 2.</exception>
+uint64_t prevPrime(uint64_t x) {
+    if (x < 2) {
+        throw std::invalid_argument("Tidak ada prima yang lebih kecil dari 2");
+    }
+    const uint64_t window = 512;
+    for (uint64_t high = x;; high -= window) {
+        uint64_t low = (high < window) ? 0 : high - window + 1;
+        std::vector<uint64_t> primes = primesInWindow(low, high);
+        if (!primes.empty()) return primes.back();
+    }
+}
+
+/// <summary>
+/// Bentuk batch <see cref="nextPrime"/> untuk query terurut naik; jendela yang tumpang tindih dipakai ulang.
+/// </summary>
+/// <param name="sortedQueries">Query terurut naik.</param>
+/// <returns>nextPrime(q) untuk setiap query, urutan sama dengan input.</returns>
+/// <exception cref="std::invalid_argument">Dilempar bila query tidak terurut.</exception>
+/// <remarks>
+/// Prima dari jendela terakhir disimpan; query berikutnya yang jatuh di dalam jendela itu
+/// dijawab dengan pencarian biner tanpa menyaring ulang.
+/// </remarks>
+std::vector<uint64_t> nextPrimeBatch(const std::vector<uint64_t>& sortedQueries) {
+    if (!std::is_sorted(sortedQueries.begin(), sortedQueries.end())) {
+        throw std::invalid_argument("Query harus terurut naik");
+    }
+    const uint64_t window = 4096;
+    std::vector<uint64_t> result;
+    result.reserve(sortedQueries.size());
+    std::vector<uint64_t> cached;
+    for (uint64_t q : sortedQueries) {
+        std::vector<uint64_t>::const_iterator it = std::lower_bound(cached.begin(), cached.end(), q);
+        if (it == cached.end()) {
+            if (q > kLargestPrime64) {
+                throw std::overflow_error("Tidak ada prima 64-bit setelah nilai ini");
+            }
+            for (uint64_t low = q; cached.empty() || cached.back() < q; low += window) {
+                uint64_t high = (low > UINT64_MAX - window) ? UINT64_MAX : low + window - 1;
+                cached = primesInWindow(low, high);
+            }
+            it = std::lower_bound(cached.begin(), cached.end(), q);
+        }
+        result.push_back(*it);
+    }
+    return result;
+}
+
+/// <summary>
+/// Bentuk batch <see cref="prevPrime"/> untuk query terurut naik; jendela yang tumpang tindih dipakai ulang.
+/// </summary>
+/// <param name="sortedQueries">Query terurut naik, masing-masing &gt;= 2.</param>
+/// <returns>prevPrime(q) untuk setiap query, urutan sama dengan input.</returns>
+/// <exception cref="std::invalid_argument">Dilempar bila query tidak terurut atau ada yang &lt; 2.</exception>
+std::vector<uint64_t> prevPrimeBatch(const std::vector<uint64_t>& sortedQueries) {
+    if (!std::is_sorted(sortedQueries.begin(), sortedQueries.end())) {
+        throw std::invalid_argument("Query harus terurut naik");
+    }
+    const uint64_t window = 4096;
+    std::vector<uint64_t> result;
+    result.reserve(sortedQueries.size());
+    std::vector<uint64_t> cached;
+    uint64_t cachedHigh = 0;
+    for (uint64_t q : sortedQueries) {
+        if (q < 2) {
+            throw std::invalid_argument("Tidak ada prima yang lebih kecil dari 2");
+        }
+        // Jendela hanya sah bila menutup q dan memuat setidaknya satu prima &lt;= q.
+        if (q > cachedHigh || cached.empty() || cached.front() > q) {
+            cachedHigh = (q > UINT64_MAX - window) ? UINT64_MAX : q + window;
+            uint64_t low = (q < window) ? 0 : q - window + 1;
+            cached = primesInWindow(low, cachedHigh);
+            while (cached.empty() || cached.front() > q) {
+                uint64_t high = low - 1;
+                low = (high < window) ? 0 : high - window + 1;
+                std::vector<uint64_t> lower = primesInWindow(low, high);
+                cached.insert(cached.begin(), lower.begin(), lower.end());
+            }
+        }
+        result.push_back(*(std::upper_bound(cached.begin(), cached.end(), q) - 1));
+    }
+    return result;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="isPrime64"/>, <see cref="nextPrime"/>, <see cref="prevPrime"/>,
+/// <see cref="primesInWindow"/>, dan bentuk batch-nya.
+/// </summary>
+void testPrimeWindows() {
+    for (int n = 0; n <= 100000; ++n) {
+        assert(isPrime64(n) == isPrime(n));
+    }
+    assert(isPrime64(2305843009213693951ull) == true);  // 2^61 - 1
+    assert(isPrime64(kLargestPrime64) == true);
+    assert(isPrime64(3215031751ull) == false);          // pseudoprima kuat basis 2, 3, 5, 7
+    assert(isPrime64(4294967291ull * 4294967279ull) == false);
+
+    assert(nextPrime(0) == 2);
+    assert(nextPrime(14) == 17);
+    assert(nextPrime(17) == 17);
+    assert(nextPrime(1000000000000ull) == 1000000000039ull);
+    assert(nextPrime(kLargestPrime64 - 23) == kLargestPrime64);
+    assert(prevPrime(2) == 2);
+    assert(prevPrime(1000000000000ull) == 999999999989ull);
+    assert(prevPrime(UINT64_MAX) == kLargestPrime64);
+    assert(prevPrime(kLargestPrime64 - 1) == kLargestPrime64 - 24);
+
+    std::vector<uint64_t> window = primesInWindow(1000000000000ull - 20, 1000000000000ull + 50);
+    assert((window == std::vector<uint64_t>{ 999999999989ull, 1000000000039ull }));
+    assert(primesInWindow(0, 100000) == primesInRange(0, 100000));
+    assert(primesInWindow(1000000000000ull, 1000000100000ull) == primesInRange(1000000000000ull, 1000000100000ull));
+
+    std::vector<uint64_t> queries = { 0, 1, 2, 8, 8, 90, 1000, 1000000000000ull, 1000000000040ull, kLargestPrime64 };
+    std::vector<uint64_t> expectedNext;
+    for (uint64_t q : queries) expectedNext.push_back(nextPrime(q));
+    assert(nextPrimeBatch(queries) == expectedNext);
+
+    std::vector<uint64_t> prevQueries(queries.begin() + 2, queries.end());
+    prevQueries.push_back(UINT64_MAX);
+    std::vector<uint64_t> expectedPrev;
+    for (uint64_t q : prevQueries) expectedPrev.push_back(prevPrime(q));
+    assert(prevPrimeBatch(prevQueries) == expectedPrev);
+
+    try {
+        nextPrime(kLargestPrime64 + 1);
+        assert(false);
+    }
+    catch (const std::overflow_error&) {
+        // Ignored, really
+    }
+    try {
+        prevPrime(1);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji prima berikut/sebelumnya lulus!\n";
+}
+
+/// <summary>
+/// Satu langkah SplitMix64: mengacak state lalu mengembalikan keluaran 64-bit.
+/// </summary>
+/// <param name="state">State yang dimajukan.</param>
+/// <returns>Bilangan acak 64-bit.</returns>
+/// <remarks>Dipakai untuk menurunkan seed generator lain dari satu seed.</remarks>
+inline uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/// <summary>
+/// Generator acak cepat xoshiro256** (bukan kriptografis).
+/// </summary>
+/// <remarks>
+/// Memenuhi konsep UniformRandomBitGenerator sehingga dapat dipakai dengan distribusi
+/// <c>&lt;random&gt;</c>. State 256-bit diinisialisasi dari seed lewat <see cref="splitMix64"/>.
+/// </remarks>
+class Xoshiro256StarStar {
+public:
+    using result_type = uint64_t;
+
+    explicit Xoshiro256StarStar(uint64_t seed) {
+        for (uint64_t& word : m_state) word = splitMix64(seed);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+
+    result_type operator()() {
+        const uint64_t result = rotateLeft(m_state[1] * 5, 7) * 9;
+        const uint64_t t = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotateLeft(m_state[3], 45);
+        return result;
+    }
+
+private:
+    static uint64_t rotateLeft(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    uint64_t m_state[4];
+};
+
+/// <summary>
+/// 16) Membangkitkan bilangan prima acak dengan panjang tepat <paramref name="bits"/> bit.
+/// </summary>
+/// <param name="bits">Panjang bit, 2..64; bit tertinggi hasil selalu 1.</param>
+/// <param name="rng">Generator acak.</param>
+/// <returns>Prima p dengan 2^(bits-1) &lt;= p &lt; 2^bits.</returns>
+/// <exception cref="std::invalid_argument">Dilempar bila <paramref name="bits"/> di luar 2..64.</exception>
+/// <remarks>
+/// Alih-alih sampel-tolak dengan uji penuh, satu kandidat ganjil acak diambil lalu
+/// dinaikkan 2 demi 2 sambil memperbarui sisa bagi terhadap prima kecil tanpa pembagian.
+/// Hanya kandidat yang lolos semua sisa (tak ada yang nol) diuji dengan Miller-Rabin.
+/// Cocok untuk seed kunci dan hash, bukan untuk kriptografi.
+/// </remarks>
+uint64_t randomPrime(unsigned bits, Xoshiro256StarStar& rng) {
+    if (bits < 2 || bits > 64) {
+        throw std::invalid_argument("Panjang bit harus 2..64");
+    }
+    const uint64_t top = 1ull << (bits - 1);
+    const uint64_t mask = (bits == 64) ? UINT64_MAX : (top << 1) - 1;
+    if (bits <= 12) {
+        // Rentang kecil: sampel-tolak biasa lebih sederhana dan tetap cepat.
+        for (;;) {
+            uint64_t candidate = (rng() & mask) | top;
+            if (isPrime64(candidate)) return candidate;
+        }
+    }
+
+    // 128 prima ganjil pertama (3..727) lebih kecil dari setiap kandidat 12+ bit.
+    const size_t residueCount = 128;
+    const std::vector<DivisibilityTest>& table = trialDivisionTable();
+    uint32_t primes[residueCount];
+    uint32_t residues[residueCount];
+    for (size_t i = 0; i < residueCount; ++i) primes[i] = table[i].prime;
+
+    const unsigned maxSteps = 1024;
+    for (;;) {
+        uint64_t candidate = (rng() & mask) | top | 1;
+        for (size_t i = 0; i < residueCount; ++i) {
+            residues[i] = static_cast<uint32_t>(candidate % primes[i]);
+        }
+        for (unsigned step = 0; step < maxSteps && candidate <= mask; ++step) {
+            uint32_t zero = 0;
+            for (size_t i = 0; i < residueCount; ++i) zero |= (residues[i] == 0);
+            if (!zero && millerRabin64(candidate)) return candidate;
+            if (candidate > mask - 2) break;
+            candidate += 2;
+            for (size_t i = 0; i < residueCount; ++i) {
+                uint32_t r = residues[i] + 2;
+                residues[i] = r >= primes[i] ? r - primes[i] : r;
+            }
+        }
+    }
+}
+
+/// <summary>
+/// Mode massal multithread untuk <see cref="randomPrime"/>.
+/// </summary>
+/// <param name="bits">Panjang bit, 2..64.</param>
+/// <param name="count">Jumlah prima yang dibangkitkan.</param>
+/// <param name="seed">Seed utama.</param>
+/// <param name="threadCount">Jumlah thread; 0 berarti sesuai perangkat keras.</param>
+/// <returns>Vektor berisi <paramref name="count"/> prima acak.</returns>
+/// <remarks>
+/// Keluaran dibagi menjadi potongan tetap; tiap potongan punya generator sendiri yang
+/// diturunkan dari seed dan nomor potongan, sehingga hasilnya sama berapa pun jumlah thread.
+/// </remarks>
+std::vector<uint64_t> generateRandomPrimes(unsigned bits, size_t count, uint64_t seed,
+                                           unsigned threadCount = 0) {
+    if (bits < 2 || bits > 64) {
+        throw std::invalid_argument("Panjang bit harus 2..64");
+    }
+    std::vector<uint64_t> primes(count);
+    const size_t chunkSize = 4096;
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    parallelFor(chunkCount, threadCount, [&](size_t chunk) {
+        uint64_t chunkSeed = seed ^ (0xD1B54A32D192ED03ull * (chunk + 1));
+        Xoshiro256StarStar rng(splitMix64(chunkSeed));
+        const size_t end = std::min(count, (chunk + 1) * chunkSize);
+        for (size_t i = chunk * chunkSize; i < end; ++i) {
+            primes[i] = randomPrime(bits, rng);
+        }
+    });
+    return primes;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="randomPrime"/> dan <see cref="generateRandomPrimes"/>.
+/// </summary>
+void testRandomPrimes() {
+    Xoshiro256StarStar rng(2024);
+    for (unsigned bits = 2; bits <= 64; ++bits) {
+        for (int trial = 0; trial < 20; ++trial) {
+            uint64_t p = randomPrime(bits, rng);
+            assert(isPrime64(p));
+            assert(p >> (bits - 1) == 1); // tepat bits bit
+        }
+    }
+
+    Xoshiro256StarStar first(7), second(7);
+    assert(randomPrime(64, first) == randomPrime(64, second));
+
+    std::vector<uint64_t> bulk = generateRandomPrimes(64, 10000, 99, 3);
+    assert(bulk == generateRandomPrimes(64, 10000, 99, 1));
+    for (uint64_t p : bulk) {
+        assert(isPrime64(p) && (p >> 63) == 1);
+    }
+    std::vector<uint64_t> sorted = bulk;
+    std::sort(sorted.begin(), sorted.end());
+    assert(std::unique(sorted.begin(), sorted.end()) - sorted.begin() > 9990);
+
+    std::vector<uint64_t> small = generateRandomPrimes(32, 5000, 5);
+    for (uint64_t p : small) {
+        assert(isPrimeByTrialDivision(static_cast<uint32_t>(p)) && (p >> 31) == 1);
+    }
+
+    try {
+        randomPrime(65, rng);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji prima acak lulus!\n";
+}
+
+/// <summary>
+/// Bilangan bulat tak bertanda berpresisi sembarang.
+/// </summary>
+/// <remarks>
+/// Disimpan sebagai limb 32-bit little-endian tanpa limb nol di depan (nol = vektor kosong).
+/// Perkalian schoolbook dan pembagian Knuth (algoritma D); cukup untuk bilangan ratusan
+/// hingga ribuan digit seperti hasil faktorial dan Fibonacci besar.
+/// </remarks>
+class BigUnsigned {
+public:
+    BigUnsigned() {}
+
+    BigUnsigned(uint64_t value) {
+        while (value != 0) {
+            m_limbs.push_back(static_cast<uint32_t>(value));
+            value >>= 32;
+        }
+    }
+
+    /// <summary>Membuat bilangan dari limb little-endian (limb nol di depan dibuang).</summary>
+    static BigUnsigned fromLimbs(std::vector<uint32_t> limbs) {
+        BigUnsigned result;
+        result.m_limbs = std::move(limbs);
+        result.trim();
+        return result;
+    }
+
+    /// <summary>Mengurai string desimal.</summary>
+    /// <exception cref="std::invalid_argument">Dilempar bila string kosong atau memuat non-digit.</exception>
+    static BigUnsigned fromString(const std::string& text) {
+        if (text.empty()) {
+            throw std::invalid_argument("String bilangan kosong");
+        }
+        BigUnsigned result;
+        for (char c : text) {
+            if (c < '0' || c > '9') {
+                throw std::invalid_argument("String bilangan memuat karakter non-digit");
+            }
+            result.multiplySmallInPlace(10);
+            result.addSmallInPlace(static_cast<uint32_t>(c - '0'));
+        }
+        return result;
+    }
+
+    /// <summary>Representasi desimal.</summary>
+    std::string toString() const {
+        if (isZero()) return "0";
+        std::vector<uint32_t> chunks; // basis 10^9, little-endian
+        BigUnsigned rest = *this;
+        while (!rest.isZero()) chunks.push_back(rest.divideSmallInPlace(1000000000u));
+        std::string text = std::to_string(chunks.back());
+        for (size_t i = chunks.size() - 1; i-- > 0;) {
+            std::string part = std::to_string(chunks[i]);
+            text.append(9 - part.size(), '0');
+            text += part;
+        }
+        return text;
+    }
+
+    const std::vector<uint32_t>& limbs() const { return m_limbs; }
+    bool isZero() const { return m_limbs.empty(); }
+    bool isOdd() const { return !m_limbs.empty() && (m_limbs[0] & 1); }
+    bool fitsUint64() const { return m_limbs.size() <= 2; }
+
+    /// <summary>64 bit terendah.</summary>
+    uint64_t low64() const {
+        uint64_t value = 0;
+        if (m_limbs.size() > 0) value = m_limbs[0];
+        if (m_limbs.size() > 1) value |= static_cast<uint64_t>(m_limbs[1]) << 32;
+        return value;
+    }
+
+    /// <summary>Jumlah bit signifikan (0 untuk nol).</summary>
+    size_t bitLength() const {
+        if (m_limbs.empty()) return 0;
+        size_t bits = 32 * m_limbs.size();
+        for (uint32_t top = m_limbs.back(); (top & 0x80000000u) == 0; top <<= 1) --bits;
+        return bits;
+    }
+
+    bool testBit(size_t bit) const {
+        return bit / 32 < m_limbs.size() && ((m_limbs[bit / 32] >> (bit % 32)) & 1);
+    }
+
+    /// <summary>Membandingkan dua bilangan: negatif, nol, atau positif.</summary>
+    static int compare(const BigUnsigned& a, const BigUnsigned& b) {
+        if (a.m_limbs.size() != b.m_limbs.size()) return a.m_limbs.size() < b.m_limbs.size() ? -1 : 1;
+        for (size_t i = a.m_limbs.size(); i-- > 0;) {
+            if (a.m_limbs[i] != b.m_limbs[i]) return a.m_limbs[i] < b.m_limbs[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    BigUnsigned& operator+=(const BigUnsigned& other) {
+        if (m_limbs.size() < other.m_limbs.size()) m_limbs.resize(other.m_limbs.size(), 0);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < m_limbs.size(); ++i) {
+            uint64_t sum = carry + m_limbs[i] + (i < other.m_limbs.size() ? other.m_limbs[i] : 0);
+            m_limbs[i] = static_cast<uint32_t>(sum);
+            carry = sum >> 32;
+            if (carry == 0 && i >= other.m_limbs.size()) break;
+        }
+        if (carry) m_limbs.push_back(static_cast<uint32_t>(carry));
+        return *this;
+    }
+
+    /// <exception cref="std::invalid_argument">Dilempar bila hasilnya negatif.</exception>
+    BigUnsigned& operator-=(const BigUnsigned& other) {
+        if (compare(*this, other) < 0) {
+            throw std::invalid_argument("Hasil pengurangan negatif");
+        }
+        int64_t borrow = 0;
+        for (size_t i = 0; i < m_limbs.size(); ++i) {
+            int64_t diff = static_cast<int64_t>(m_limbs[i]) - borrow -
+                (i < other.m_limbs.size() ? static_cast<int64_t>(other.m_limbs[i]) : 0);
+            borrow = diff < 0;
+            m_limbs[i] = static_cast<uint32_t>(diff + (borrow << 32));
+            if (borrow == 0 && i >= other.m_limbs.size()) break;
+        }
+        trim();
+        return *this;
+    }
+
+    /// <summary>Mengalikan di tempat dengan bilangan 32-bit tanpa alokasi bila kapasitas cukup.</summary>
+    void multiplySmallInPlace(uint32_t factor) {
+        uint64_t carry = 0;
+        for (uint32_t& limb : m_limbs) {
+            uint64_t product = static_cast<uint64_t>(limb) * factor + carry;
+            limb = static_cast<uint32_t>(product);
+            carry = product >> 32;
+        }
+        if (carry) m_limbs.push_back(static_cast<uint32_t>(carry));
+        trim();
+    }
+
+    /// <summary>Menambahkan bilangan 32-bit di tempat.</summary>
+    void addSmallInPlace(uint32_t value) {
+        for (size_t i = 0; value != 0; ++i) {
+            if (i == m_limbs.size()) {
+                m_limbs.push_back(value);
+                break;
+            }
+            uint64_t sum = static_cast<uint64_t>(m_limbs[i]) + value;
+            m_limbs[i] = static_cast<uint32_t>(sum);
+            value = static_cast<uint32_t>(sum >> 32);
+        }
+    }
+
+    /// <summary>Membagi di tempat dengan pembagi 32-bit dan mengembalikan sisanya.</summary>
+    uint32_t divideSmallInPlace(uint32_t divisor) {
+        uint64_t remainder = 0;
+        for (size_t i = m_limbs.size(); i-- > 0;) {
+            uint64_t current = (remainder << 32) | m_limbs[i];
+            m_limbs[i] = static_cast<uint32_t>(current / divisor);
+            remainder = current % divisor;
+        }
+        trim();
+        return static_cast<uint32_t>(remainder);
+    }
+
+    /// <summary>Sisa bagi dengan pembagi 32-bit.</summary>
+    uint32_t modSmall(uint32_t divisor) const {
+        uint64_t remainder = 0;
+        for (size_t i = m_limbs.size(); i-- > 0;) {
+            remainder = ((remainder << 32) | m_limbs[i]) % divisor;
+        }
+        return static_cast<uint32_t>(remainder);
+    }
+
+    /// <summary><paramref name="count"/> bit terendah, yaitu nilai mod 2^count.</summary>
+    BigUnsigned lowBits(size_t count) const {
+        if (count >= 32 * m_limbs.size()) return *this;
+        std::vector<uint32_t> limbs(m_limbs.begin(), m_limbs.begin() + (count + 31) / 32);
+        if (count % 32 != 0) limbs.back() &= (1u << (count % 32)) - 1;
+        return fromLimbs(std::move(limbs));
+    }
+
+    friend BigUnsigned operator+(BigUnsigned a, const BigUnsigned& b) { return a += b; }
+    friend BigUnsigned operator-(BigUnsigned a, const BigUnsigned& b) { return a -= b; }
+
+    friend BigUnsigned operator*(const BigUnsigned& a, const BigUnsigned& b) {
+        if (a.isZero() || b.isZero()) return BigUnsigned();
+        std::vector<uint32_t> product(a.m_limbs.size() + b.m_limbs.size(), 0);
+        for (size_t i = 0; i < a.m_limbs.size(); ++i) {
+            uint64_t carry = 0;
+            const uint64_t ai = a.m_limbs[i];
+            for (size_t j = 0; j < b.m_limbs.size(); ++j) {
+                uint64_t t = ai * b.m_limbs[j] + product[i + j] + carry;
+                product[i + j] = static_cast<uint32_t>(t);
+                carry = t >> 32;
+            }
+            product[i + b.m_limbs.size()] = static_cast<uint32_t>(carry);
+        }
+        return fromLimbs(std::move(product));
+    }
+
+    friend BigUnsigned operator<<(const BigUnsigned& a, size_t shift) {
+        if (a.isZero()) return a;
+        const size_t limbShift = shift / 32;
+        const unsigned bitShift = shift % 32;
+        std::vector<uint32_t> limbs(a.m_limbs.size() + limbShift + 1, 0);
+        for (size_t i = 0; i < a.m_limbs.size(); ++i) {
+            uint64_t value = static_cast<uint64_t>(a.m_limbs[i]) << bitShift;
+            limbs[i + limbShift] |= static_cast<uint32_t>(value);
+            limbs[i + limbShift + 1] |= static_cast<uint32_t>(value >> 32);
+        }
+        return fromLimbs(std::move(limbs));
+    }
+
+    friend BigUnsigned operator>>(const BigUnsigned& a, size_t shift) {
+        const size_t limbShift = shift / 32;
+        const unsigned bitShift = shift % 32;
+        if (limbShift >= a.m_limbs.size()) return BigUnsigned();
+        std::vector<uint32_t> limbs(a.m_limbs.size() - limbShift);
+        for (size_t i = 0; i < limbs.size(); ++i) {
+            uint64_t value = a.m_limbs[i + limbShift];
+            if (i + limbShift + 1 < a.m_limbs.size()) {
+                value |= static_cast<uint64_t>(a.m_limbs[i + limbShift + 1]) << 32;
+            }
+            limbs[i] = static_cast<uint32_t>(value >> bitShift);
+        }
+        return fromLimbs(std::move(limbs));
+    }
+
+    /// <summary>
+    /// Pembagian bersisa: a = quotient * b + remainder.
+    /// </summary>
+    /// <exception cref="std::invalid_argument">Dilempar bila b nol.</exception>
+    static void divMod(const BigUnsigned& a, const BigUnsigned& b, BigUnsigned& quotient, BigUnsigned& remainder) {
+        if (b.isZero()) {
+            throw std::invalid_argument("Pembagian dengan nol");
+        }
+        if (compare(a, b) < 0) {
+            quotient = BigUnsigned();
+            remainder = a;
+            return;
+        }
+        if (b.m_limbs.size() == 1) {
+            quotient = a;
+            remainder = BigUnsigned(quotient.divideSmallInPlace(b.m_limbs[0]));
+            return;
+        }
+
+        // Knuth algoritma D: normalisasi agar limb teratas pembagi ber-MSB 1.
+        unsigned shift = 0;
+        for (uint32_t top = b.m_limbs.back(); (top & 0x80000000u) == 0; top <<= 1) ++shift;
+        std::vector<uint32_t> v = (b << shift).m_limbs;
+        std::vector<uint32_t> u = (a << shift).m_limbs;
+        u.resize(a.m_limbs.size() + 1, 0);
+        const size_t n = v.size();
+        const size_t m = u.size() - n;
+        std::vector<uint32_t> q(m, 0);
+        const uint64_t base = 1ull << 32;
+
+        for (size_t j = m; j-- > 0;) {
+            uint64_t numerator = (static_cast<uint64_t>(u[j + n]) << 32) | u[j + n - 1];
+            uint64_t qhat = numerator / v[n - 1];
+            uint64_t rhat = numerator % v[n - 1];
+            while (qhat >= base || qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2])) {
+                --qhat;
+                rhat += v[n - 1];
+                if (rhat >= base) break;
+            }
+            int64_t borrow = 0;
+            int64_t t;
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t product = qhat * v[i];
+                t = static_cast<int64_t>(u[i + j]) - borrow - static_cast<int64_t>(product & 0xFFFFFFFFull);
+                u[i + j] = static_cast<uint32_t>(t);
+                borrow = static_cast<int64_t>(product >> 32) - (t >> 32);
+            }
+            t = static_cast<int64_t>(u[j + n]) - borrow;
+            u[j + n] = static_cast<uint32_t>(t);
+            q[j] = static_cast<uint32_t>(qhat);
+            if (t < 0) {
+                // qhat kelebihan satu: tambahkan kembali pembagi.
+                --q[j];
+                uint64_t carry = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    uint64_t sum = static_cast<uint64_t>(u[i + j]) + v[i] + carry;
+                    u[i + j] = static_cast<uint32_t>(sum);
+                    carry = sum >> 32;
+                }
+                u[j + n] += static_cast<uint32_t>(carry);
+            }
+        }
+        quotient = fromLimbs(std::move(q));
+        u.resize(n);
+        remainder = fromLimbs(std::move(u)) >> shift;
+    }
+
+    friend BigUnsigned operator/(const BigUnsigned& a, const BigUnsigned& b) {
+        BigUnsigned quotient, remainder;
+        divMod(a, b, quotient, remainder);
+        return quotient;
+    }
+
+    friend BigUnsigned operator%(const BigUnsigned& a, const BigUnsigned& b) {
+        BigUnsigned quotient, remainder;
+        divMod(a, b, quotient, remainder);
+        return remainder;
+    }
+
+    friend bool operator==(const BigUnsigned& a, const BigUnsigned& b) { return a.m_limbs == b.m_limbs; }
+    friend bool operator!=(const BigUnsigned& a, const BigUnsigned& b) { return a.m_limbs != b.m_limbs; }
+    friend bool operator<(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) < 0; }
+    friend bool operator<=(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) <= 0; }
+    friend bool operator>(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) > 0; }
+    friend bool operator>=(const BigUnsigned& a, const BigUnsigned& b) { return compare(a, b) >= 0; }
+
+private:
+    void trim() {
+        while (!m_limbs.empty() && m_limbs.back() == 0) m_limbs.pop_back();
+    }
+
+    std::vector<uint32_t> m_limbs;
+};
+
+/// <summary>
+/// Faktorial n! berpresisi sembarang (tanpa overflow seperti <see cref="factorial"/>).
+/// </summary>
+/// <param name="n">Bilangan bulat n &gt;= 0.</param>
+/// <returns>n! sebagai <see cref="BigUnsigned"/>.</returns>
+BigUnsigned factorialBig(uint32_t n) {
+    BigUnsigned result(1);
+    for (uint32_t i = 2; i <= n; ++i) result.multiplySmallInPlace(i);
+    return result;
+}
+
+/// <summary>
+/// Bilangan Fibonacci F(n) berpresisi sembarang (tanpa overflow seperti <see cref="fibonacci"/>).
+/// </summary>
+/// <param name="n">Indeks n &gt;= 0.</param>
+/// <returns>F(n) sebagai <see cref="BigUnsigned"/>.</returns>
+BigUnsigned fibonacciBig(uint32_t n) {
+    BigUnsigned a(0), b(1);
+    for (uint32_t i = 0; i < n; ++i) {
+        a += b;
+        std::swap(a, b);
+    }
+    return a;
+}
+
+/// <summary>
+/// Rencana NTT (number-theoretic transform) untuk satu ukuran dan satu modulus prima.
+/// </summary>
+/// <remarks>
+/// Tabel akar satuan tiap tahap dihitung sekali di konstruktor lalu dipakai ulang oleh
+/// setiap transformasi, sehingga pemanggilan berulang (misalnya iterasi Lucas-Lehmer)
+/// hanya membayar butterfly-nya saja.
+/// </remarks>
+class NttPlan {
+public:
+    /// <summary>Modulus Goldilocks 2^64 - 2^32 + 1 (akar primitif 7), mendukung ukuran hingga 2^32.</summary>
+    static const uint64_t kGoldilocksModulus = 0xFFFFFFFF00000001ull;
+
+    /// <param name="size">Ukuran transformasi, pangkat dua yang membagi modulus - 1.</param>
+    /// <param name="modulus">Modulus prima.</param>
+    /// <param name="generator">Akar primitif modulus.</param>
+    /// <exception cref="std::invalid_argument">Dilempar bila ukuran tidak didukung modulus.</exception>
+    NttPlan(size_t size, uint64_t modulus, uint64_t generator)
+        : m_size(size), m_modulus(modulus), m_roots(size), m_inverseRoots(size) {
+        if (size == 0 || (size & (size - 1)) != 0 || (modulus - 1) % size != 0) {
+            throw std::invalid_argument("Ukuran NTT tidak didukung modulus");
+        }
+        // m_roots[half + j] = w_len^j untuk setiap tahap dengan len = 2 * half.
+        for (size_t half = 1; half < size; half <<= 1) {
+            uint64_t w = powMod64(generator, (modulus - 1) / (2 * half), modulus);
+            uint64_t wInverse = powMod64(w, modulus - 2, modulus);
+            uint64_t current = 1, currentInverse = 1;
+            for (size_t j = 0; j < half; ++j) {
+                m_roots[half + j] = current;
+                m_inverseRoots[half + j] = currentInverse;
+                current = mulMod64(current, w, modulus);
+                currentInverse = mulMod64(currentInverse, wInverse, modulus);
+            }
+        }
+        m_sizeInverse = powMod64(size % modulus, modulus - 2, modulus);
+    }
+
+    size_t size() const { return m_size; }
+    uint64_t modulus() const { return m_modulus; }
+
+    /// <summary>Transformasi maju di tempat; <paramref name="values"/> berukuran <see cref="size"/>.</summary>
+    void forward(std::vector<uint64_t>& values) const { transform(values, m_roots); }
+
+    /// <summary>Transformasi balik di tempat, termasuk pembagian dengan ukuran.</summary>
+    void inverse(std::vector<uint64_t>& values) const {
+        transform(values, m_inverseRoots);
+        for (uint64_t& value : values) value = mulMod64(value, m_sizeInverse, m_modulus);
+    }
+
+private:
+    void transform(std::vector<uint64_t>& values, const std::vector<uint64_t>& roots) const {
+        for (size_t i = 1, j = 0; i < m_size; ++i) {
+            size_t bit = m_size >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(values[i], values[j]);
+        }
+        for (size_t half = 1; half < m_size; half <<= 1) {
+            for (size_t start = 0; start < m_size; start += 2 * half) {
+                for (size_t j = 0; j < half; ++j) {
+                    uint64_t u = values[start + j];
+                    uint64_t v = mulMod64(values[start + j + half], roots[half + j], m_modulus);
+                    values[start + j] = (u >= m_modulus - v) ? u - (m_modulus - v) : u + v;
+                    values[start + j + half] = (u >= v) ? u - v : u + (m_modulus - v);
+                }
+            }
+        }
+    }
+
+    size_t m_size;
+    uint64_t m_modulus;
+    uint64_t m_sizeInverse = 1;
+    std::vector<uint64_t> m_roots;
+    std::vector<uint64_t> m_inverseRoots;
+};
+
+/// <summary>
+/// Kuadrat bilangan besar lewat konvolusi NTT Goldilocks dengan digit 16-bit.
+/// </summary>
+/// <param name="value">Bilangan yang dikuadratkan.</param>
+/// <param name="plan">Rencana NTT Goldilocks dengan ukuran &gt;= 2 * jumlah digit 16-bit.</param>
+/// <param name="scratch">Buffer kerja yang dipakai ulang antar panggilan.</param>
+/// <returns>value^2.</returns>
+/// <remarks>
+/// Operand cukup ditransformasi sekali lalu dikuadratkan titik demi titik, jadi biaya satu
+/// kuadrat sama dengan satu konvolusi (transformasi maju + balik). Koefisien &lt; n * 2^32
+/// sehingga tidak pernah melampaui modulus.
+/// </remarks>
+BigUnsigned squareByNtt(const BigUnsigned& value, const NttPlan& plan, std::vector<uint64_t>& scratch) {
+    const std::vector<uint32_t>& limbs = value.limbs();
+    if (2 * 2 * limbs.size() > plan.size()) {
+        throw std::invalid_argument("Rencana NTT terlalu kecil untuk operand");
+    }
+    scratch.assign(plan.size(), 0);
+    for (size_t i = 0; i < limbs.size(); ++i) {
+        scratch[2 * i] = limbs[i] & 0xFFFF;
+        scratch[2 * i + 1] = limbs[i] >> 16;
+    }
+    plan.forward(scratch);
+    for (uint64_t& x : scratch) x = mulMod64(x, x, plan.modulus());
+    plan.inverse(scratch);
+
+    std::vector<uint32_t> result(4 * limbs.size() / 2 + 1, 0);
+    uint64_t carry = 0;
+    for (size_t k = 0; k < 2 * result.size(); ++k) {
+        uint64_t t = carry + (k < scratch.size() ? scratch[k] : 0);
+        result[k / 2] |= static_cast<uint32_t>(t & 0xFFFF) << (16 * (k % 2));
+        carry = t >> 16;
+    }
+    return BigUnsigned::fromLimbs(std::move(result));
+}
+
+/// <summary>
+/// 17a) Uji Lucas-Lehmer: apakah bilangan Mersenne 2^p - 1 prima.
+/// </summary>
+/// <param name="p">Eksponen Mersenne.</param>
+/// <param name="nttThreshold">Eksponen mulai dari nilai ini memakai kuadrat NTT; di bawahnya schoolbook.</param>
+/// <returns>True jika 2^p - 1 prima.</returns>
+/// <remarks>
+/// s(0) = 4, s(k+1) = s(k)^2 - 2 mod M_p; M_p prima tepat bila s(p-2) = 0. Reduksi mod M_p
+/// cukup dengan lipatan (x mod 2^p) + (x &gt;&gt; p) tanpa pembagian, dan rencana NTT beserta
+/// buffernya dibuat sekali untuk semua p - 2 iterasi.
+/// </remarks>
+bool lucasLehmer(uint32_t p, uint32_t nttThreshold = 1024) {
+    if (p == 2) return true;
+    if (!isPrime64(p)) return false;
+    const BigUnsigned mersenne = (BigUnsigned(1) << p) - BigUnsigned(1);
+    const BigUnsigned two(2);
+
+    size_t nttSize = 1;
+    while (nttSize < 2 * ((p + 15) / 16 + 1)) nttSize <<= 1;
+    const bool useNtt = p >= nttThreshold;
+    std::unique_ptr<NttPlan> plan;
+    if (useNtt) plan.reset(new NttPlan(nttSize, NttPlan::kGoldilocksModulus, 7));
+    std::vector<uint64_t> scratch;
+
+    BigUnsigned s(4);
+    for (uint32_t i = 0; i < p - 2; ++i) {
+        BigUnsigned square = useNtt ? squareByNtt(s, *plan, scratch) : s * s;
+        while (square.bitLength() > p) {
+            square = square.lowBits(p) + (square >> p);
+        }
+        if (square == mersenne) square = BigUnsigned();
+        s = (square < two) ? square + mersenne - two : square - two;
+    }
+    return s.isZero();
+}
+
+/// <summary>
+/// Simbol Jacobi (a/n) untuk bilangan kecil, n ganjil positif.
+/// </summary>
+int jacobiSymbol(uint64_t a, uint64_t n) {
+    int result = 1;
+    a %= n;
+    while (a != 0) {
+        while (a % 2 == 0) {
+            a /= 2;
+            if (n % 8 == 3 || n % 8 == 5) result = -result;
+        }
+        std::swap(a, n);
+        if (a % 4 == 3 && n % 4 == 3) result = -result;
+        a %= n;
+    }
+    return n == 1 ? result : 0;
+}
+
+/// <summary>
+/// 17b) Uji keprimaan Baillie-PSW untuk bilangan berpresisi sembarang.
+/// </summary>
+/// <param name="n">Bilangan yang diuji.</param>
+/// <returns>True jika n (mungkin) prima; belum pernah ditemukan komposit yang lolos.</returns>
+/// <remarks>
+/// Pra-filter prima kecil, uji Miller-Rabin kuat basis 2, penolakan kuadrat sempurna,
+/// lalu uji Lucas kuat dengan parameter Selfridge (D pertama dari 5, -7, 9, ... dengan
+/// (D/n) = -1, P = 1, Q = (1 - D)/4). Bilangan yang muat 64-bit memakai <see cref="isPrime64"/>.
+/// </remarks>
+bool isProbablePrimeBpsw(const BigUnsigned& n) {
+    if (n.fitsUint64()) return isPrime64(n.low64());
+    if (!n.isOdd()) return false;
+    for (const DivisibilityTest& test : trialDivisionTable()) {
+        if (test.prime > 1000) break;
+        if (n.modSmall(test.prime) == 0) return false;
+    }
+
+    auto mulMod = [&n](const BigUnsigned& a, const BigUnsigned& b) { return (a * b) % n; };
+    auto addMod = [&n](const BigUnsigned& a, const BigUnsigned& b) {
+        BigUnsigned sum = a + b;
+        return sum >= n ? sum - n : sum;
+    };
+    auto subMod = [&n](const BigUnsigned& a, const BigUnsigned& b) { return a >= b ? a - b : a + n - b; };
+    auto half = [&n](BigUnsigned a) {
+        if (a.isOdd()) a += n;
+        return a >> 1;
+    };
+    const BigUnsigned one(1);
+    const BigUnsigned nMinusOne = n - one;
+
+    // Miller-Rabin kuat basis 2.
+    size_t shift = 0;
+    while (!nMinusOne.testBit(shift)) ++shift;
+    const BigUnsigned d = nMinusOne >> shift;
+    BigUnsigned x(1), base(2);
+    for (size_t bit = d.bitLength(); bit-- > 0;) {
+        x = mulMod(x, x);
+        if (d.testBit(bit)) x = mulMod(x, base);
+    }
+    if (x != one && x != nMinusOne) {
+        bool witness = true;
+        for (size_t r = 1; r < shift && witness; ++r) {
+            x = mulMod(x, x);
+            if (x == nMinusOne) witness = false;
+        }
+        if (witness) return false;
+    }
+
+    // Kuadrat sempurna tidak punya D dengan (D/n) = -1, jadi tolak lebih dulu.
+    BigUnsigned root = BigUnsigned(1) << ((n.bitLength() + 1) / 2);
+    for (;;) {
+        BigUnsigned next = (root + n / root) >> 1;
+        if (next >= root) break;
+        root = next;
+    }
+    if (root * root == n) return false;
+
+    // Parameter Selfridge.
+    int64_t D = 5;
+    for (;;) {
+        uint64_t magnitude = static_cast<uint64_t>(D < 0 ? -D : D);
+        uint64_t reduced = n.modSmall(static_cast<uint32_t>(magnitude));
+        // (D/n) = (|D|/n) * (-1/n) bila D negatif; (|D|/n) = (n/|D|) dengan faktor resiprositas.
+        int symbol = jacobiSymbol(reduced, magnitude);
+        if (magnitude % 4 == 3 && n.modSmall(4) == 3) symbol = -symbol;
+        if (D < 0 && n.modSmall(4) == 3) symbol = -symbol;
+        if (symbol == -1) break;
+        if (symbol == 0 && BigUnsigned(magnitude) != n) return false;
+        D = (D > 0) ? -(D + 2) : -(D - 2);
+    }
+    const BigUnsigned Dmod = D > 0 ? BigUnsigned(static_cast<uint64_t>(D)) % n
+                                   : n - BigUnsigned(static_cast<uint64_t>(-D)) % n;
+    const int64_t qValue = (1 - D) / 4;
+    const BigUnsigned Q = qValue >= 0 ? BigUnsigned(static_cast<uint64_t>(qValue)) % n
+                                      : n - BigUnsigned(static_cast<uint64_t>(-qValue)) % n;
+
+    // Uji Lucas kuat: n + 1 = dl * 2^s.
+    const BigUnsigned nPlusOne = n + one;
+    size_t lucasShift = 0;
+    while (!nPlusOne.testBit(lucasShift)) ++lucasShift;
+    const BigUnsigned dl = nPlusOne >> lucasShift;
+    BigUnsigned U(1), V(1), Qk = Q; // U_1, V_1 dengan P = 1
+    for (size_t bit = dl.bitLength() - 1; bit-- > 0;) {
+        U = mulMod(U, V);
+        V = subMod(mulMod(V, V), addMod(Qk, Qk));
+        Qk = mulMod(Qk, Qk);
+        if (dl.testBit(bit)) {
+            BigUnsigned nextU = half(addMod(U, V));
+            V = half(addMod(mulMod(Dmod, U), V));
+            U = nextU;
+            Qk = mulMod(Qk, Q);
+        }
+    }
+    if (U.isZero() || V.isZero()) return true;
+    for (size_t r = 1; r < lucasShift; ++r) {
+        V = subMod(mulMod(V, V), addMod(Qk, Qk));
+        if (V.isZero()) return true;
+        Qk = mulMod(Qk, Qk);
+    }
+    return false;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="BigUnsigned"/>, <see cref="lucasLehmer"/>, dan <see cref="isProbablePrimeBpsw"/>.
+/// </summary>
+void testBigPrimality() {
+    assert(factorialBig(20).toString() == "2432902008176640000");
+    assert(factorialBig(25).toString() == "15511210043330985984000000");
+    assert(fibonacciBig(100).toString() == "354224848179261915075");
+    BigUnsigned big = BigUnsigned::fromString("123456789012345678901234567890123456789");
+    BigUnsigned divisor = BigUnsigned::fromString("9876543210987654321");
+    BigUnsigned quotient, remainder;
+    BigUnsigned::divMod(big, divisor, quotient, remainder);
+    assert(quotient * divisor + remainder == big && remainder < divisor);
+    assert(quotient.toString() == "12499999886093750001");
+    assert((big - big).isZero());
+
+    const uint32_t mersennePrimes[] = { 2, 3, 5, 7, 13, 17, 19, 31, 61, 89, 107, 127, 521, 607 };
+    for (uint32_t p : mersennePrimes) {
+        assert(lucasLehmer(p) && lucasLehmer(p, 0));
+    }
+    const uint32_t composites[] = { 4, 11, 23, 29, 37, 41, 43, 47, 53, 59, 67, 523 };
+    for (uint32_t p : composites) {
+        assert(!lucasLehmer(p) && !lucasLehmer(p, 0));
+    }
+    assert(lucasLehmer(1279));
+
+    const BigUnsigned one(1);
+    // Pseudoprima kuat basis 2 di atas 2^64 berbentuk (6k+1)(12k+1)(18k+1): lolos Miller-Rabin,
+    // jadi hanya uji Lucas kuat yang dapat menolaknya.
+    const char* const strongPseudoprimes[][4] = {
+        { "1299837745921707516889", "6005917", "12011833", "18017749" },
+        { "1305416518666163736769", "6014497", "12028993", "18043489" },
+    };
+    for (const auto& pseudoprime : strongPseudoprimes) {
+        const BigUnsigned n = BigUnsigned::fromString(pseudoprime[0]);
+        assert(!n.fitsUint64());
+        assert(BigUnsigned::fromString(pseudoprime[1]) * BigUnsigned::fromString(pseudoprime[2]) *
+            BigUnsigned::fromString(pseudoprime[3]) == n);
+        assert(!isProbablePrimeBpsw(n));
+    }
+    assert(isProbablePrimeBpsw((one << 89) - one));
+    assert(isProbablePrimeBpsw((one << 127) - one));
+    assert(!isProbablePrimeBpsw((one << 128) + one));      // F7 komposit
+    assert(!isProbablePrimeBpsw((one << 67) - one));
+    assert(isProbablePrimeBpsw(factorialBig(27) + one));   // 27! + 1 prima
+    assert(!isProbablePrimeBpsw(factorialBig(26) + one));
+    assert(isProbablePrimeBpsw(fibonacciBig(83)));
+    assert(!isProbablePrimeBpsw(fibonacciBig(97)));
+    BigUnsigned square = BigUnsigned::fromString("1000000000000000000117") * BigUnsigned::fromString("1000000000000000000117");
+    assert(!isProbablePrimeBpsw(square));
+
+    try {
+        big / BigUnsigned();
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji keprimaan bilangan besar lulus!\n";
+}
+
+/// <summary>
+/// Hasil kali penuh 64 x 64 -&gt; 128 bit.
+/// </summary>
+/// <param name="a">Faktor pertama.</param>
+/// <param name="b">Faktor kedua.</param>
+/// <param name="high">Keluaran: 64 bit atas.</param>
+/// <returns>64 bit bawah.</returns>
+inline uint64_t multiplyWide(uint64_t a, uint64_t b, uint64_t& high) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    high = static_cast<uint64_t>(product >> 64);
+    return static_cast<uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, &high);
+#else
+    const uint64_t aLow = a & 0xFFFFFFFFull, aHigh = a >> 32;
+    const uint64_t bLow = b & 0xFFFFFFFFull, bHigh = b >> 32;
+    const uint64_t ll = aLow * bLow, lh = aLow * bHigh, hl = aHigh * bLow, hh = aHigh * bHigh;
+    const uint64_t middle = (ll >> 32) + (lh & 0xFFFFFFFFull) + (hl & 0xFFFFFFFFull);
+    high = hh + (lh >> 32) + (hl >> 32) + (middle >> 32);
+    return (middle << 32) | (ll & 0xFFFFFFFFull);
+#endif
+}
+
+/// <summary>
+/// 18a) Konteks aritmetika Montgomery untuk modulus ganjil 64-bit.
+/// </summary>
+/// <remarks>
+/// Nilai disimpan dalam bentuk Montgomery a*R mod n dengan R = 2^64, sehingga perkalian
+/// modular cukup dua perkalian lebar dan satu pengurangan tanpa pembagian. Varian REDC
+/// berbasis pengurangan dipakai agar benar untuk seluruh modulus ganjil &lt; 2^64.
+/// </remarks>
+class MontgomeryContext64 {
+public:
+    /// <exception cref="std::invalid_argument">Dilempar bila modulus genap atau 1.</exception>
+    explicit MontgomeryContext64(uint64_t modulus) : m_modulus(modulus) {
+        if (modulus % 2 == 0 || modulus == 1) {
+            throw std::invalid_argument("Modulus Montgomery harus ganjil dan > 1");
+        }
+        uint64_t inverse = modulus;
+        for (int i = 0; i < 5; ++i) inverse *= 2 - modulus * inverse;
+        m_inverse = inverse;
+        m_one = (0 - modulus) % modulus; // 2^64 mod n
+        m_rSquared = mulMod64(m_one, m_one, modulus);
+    }
+
+    uint64_t modulus() const { return m_modulus; }
+    /// <summary>Bentuk Montgomery dari 1.</summary>
+    uint64_t one() const { return m_one; }
+
+    uint64_t toMontgomery(uint64_t a) const { return multiply(a % m_modulus, m_rSquared); }
+    uint64_t fromMontgomery(uint64_t a) const { return reduce(0, a); }
+
+    /// <summary>Perkalian dua nilai berbentuk Montgomery.</summary>
+    uint64_t multiply(uint64_t a, uint64_t b) const {
+        uint64_t high;
+        uint64_t low = multiplyWide(a, b, high);
+        return reduce(high, low);
+    }
+
+    uint64_t add(uint64_t a, uint64_t b) const {
+        return (a >= m_modulus - b) ? a - (m_modulus - b) : a + b;
+    }
+
+    uint64_t subtract(uint64_t a, uint64_t b) const {
+        return (a >= b) ? a - b : a + (m_modulus - b);
+    }
+
+    /// <summary>base^exponent mod n; masukan dan keluaran dalam bentuk biasa.</summary>
+    uint64_t pow(uint64_t base, uint64_t exponent) const {
+        return fromMontgomery(powMontgomery(toMontgomery(base), exponent));
+    }
+
+    /// <summary>Perpangkatan dengan basis dan hasil dalam bentuk Montgomery.</summary>
+    uint64_t powMontgomery(uint64_t base, uint64_t exponent) const {
+        uint64_t result = m_one;
+        while (exponent != 0) {
+            if (exponent & 1) result = multiply(result, base);
+            base = multiply(base, base);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+private:
+    /// <summary>REDC: (high:low) / R mod n untuk (high:low) &lt; n * R.</summary>
+    uint64_t reduce(uint64_t high, uint64_t low) const {
+        uint64_t m = low * m_inverse;
+        uint64_t mnHigh;
+        multiplyWide(m, m_modulus, mnHigh);
+        return (high >= mnHigh) ? high - mnHigh : high + (m_modulus - mnHigh);
+    }
+
+    uint64_t m_modulus;
+    uint64_t m_inverse;
+    uint64_t m_one;
+    uint64_t m_rSquared;
+};
+
+/// <summary>
+/// 18b) Konteks aritmetika Montgomery untuk modulus ganjil 32-bit (R = 2^32).
+/// </summary>
+/// <remarks>
+/// Semua hasil kali muat 64-bit, sehingga loop di atas banyak lajur dapat divektorisasi
+/// (misalnya <c>vpmuludq</c> pada AVX2) oleh kompilator.
+/// </remarks>
+class MontgomeryContext32 {
+public:
+    /// <exception cref="std::invalid_argument">Dilempar bila modulus genap atau 1.</exception>
+    explicit MontgomeryContext32(uint32_t modulus) : m_modulus(modulus) {
+        if (modulus % 2 == 0 || modulus == 1) {
+            throw std::invalid_argument("Modulus Montgomery harus ganjil dan > 1");
+        }
+        uint32_t inverse = modulus;
+        for (int i = 0; i < 4; ++i) inverse *= 2 - modulus * inverse;
+        m_inverse = inverse;
+        m_one = static_cast<uint32_t>((1ull << 32) % modulus);
+        m_rSquared = static_cast<uint32_t>(static_cast<uint64_t>(m_one) * m_one % modulus);
+    }
+
+    uint32_t modulus() const { return m_modulus; }
+    uint32_t one() const { return m_one; }
+
+    uint32_t toMontgomery(uint32_t a) const { return multiply(a % m_modulus, m_rSquared); }
+    uint32_t fromMontgomery(uint32_t a) const { return reduce(a); }
+
+    uint32_t multiply(uint32_t a, uint32_t b) const {
+        return reduce(static_cast<uint64_t>(a) * b);
+    }
+
+    uint32_t pow(uint32_t base, uint64_t exponent) const {
+        uint32_t result = m_one;
+        uint32_t b = toMontgomery(base);
+        while (exponent != 0) {
+            if (exponent & 1) result = multiply(result, b);
+            b = multiply(b, b);
+            exponent >>= 1;
+        }
+        return fromMontgomery(result);
+    }
+
+    /// <summary>REDC 32-bit untuk product &lt; n * 2^32.</summary>
+    uint32_t reduce(uint64_t product) const {
+        uint32_t m = static_cast<uint32_t>(product) * m_inverse;
+        uint32_t high = static_cast<uint32_t>(product >> 32);
+        uint32_t mnHigh = static_cast<uint32_t>((static_cast<uint64_t>(m) * m_modulus) >> 32);
+        return (high >= mnHigh) ? high - mnHigh : high + (m_modulus - mnHigh);
+    }
+
+private:
+    uint32_t m_modulus;
+    uint32_t m_inverse;
+    uint32_t m_one;
+    uint32_t m_rSquared;
+};
+
+/// <summary>
+/// 18c) Reduksi Barrett untuk modulus &lt; 2^32 (modulus genap pun boleh).
+/// </summary>
+/// <remarks>
+/// x mod n dihitung dari q = floor(x * m / 2^64) dengan m = floor((2^64 - 1) / n),
+/// lalu paling banyak dua koreksi pengurangan.
+/// </remarks>
+class BarrettContext32 {
+public:
+    /// <exception cref="std::invalid_argument">Dilempar bila modulus 0.</exception>
+    explicit BarrettContext32(uint32_t modulus) : m_modulus(modulus) {
+        if (modulus == 0) {
+            throw std::invalid_argument("Modulus Barrett harus positif");
+        }
+        m_factor = UINT64_MAX / modulus;
+    }
+
+    uint32_t modulus() const { return m_modulus; }
+
+    /// <summary>x mod n untuk sembarang x 64-bit.</summary>
+    uint32_t reduce(uint64_t x) const {
+        uint64_t quotient;
+        multiplyWide(x, m_factor, quotient);
+        uint64_t remainder = x - quotient * m_modulus;
+        while (remainder >= m_modulus) remainder -= m_modulus;
+        return static_cast<uint32_t>(remainder);
+    }
+
+    uint32_t multiply(uint32_t a, uint32_t b) const { return reduce(static_cast<uint64_t>(a) * b); }
+
+private:
+    uint32_t m_modulus;
+    uint64_t m_factor;
+};
+
+/// <summary>
+/// 18d) Reduksi Barrett untuk modulus 64-bit &lt; 2^62 dengan resiprokal 128-bit.
+/// </summary>
+/// <remarks>
+/// Untuk x &lt; n^2, q = floor(x * mu / 2^128) dengan mu = floor(2^128 / n) meleset paling
+/// banyak 2 dari hasil bagi sebenarnya; batas 2^62 menjamin sisa sementara muat 64-bit.
+/// </remarks>
+class BarrettContext64 {
+public:
+    /// <exception cref="std::invalid_argument">Dilempar bila modulus &lt; 2 atau &gt;= 2^62.</exception>
+    explicit BarrettContext64(uint64_t modulus) : m_modulus(modulus) {
+        if (modulus < 2 || modulus >= (1ull << 62)) {
+            throw std::invalid_argument("Modulus Barrett 64-bit harus di [2, 2^62)");
+        }
+        // mu = floor((2^128 - 1) / n) lewat pembagian panjang dua digit basis 2^64.
+        m_muHigh = UINT64_MAX / modulus;
+        uint64_t remainder = UINT64_MAX % modulus;
+        uint64_t low = 0;
+        for (int bit = 63; bit >= 0; --bit) {
+            // remainder &lt; n &lt; 2^62, jadi penggandaan tidak overflow.
+            remainder = (remainder << 1) | 1;
+            if (remainder >= modulus) {
+                remainder -= modulus;
+                low |= 1ull << bit;
+            }
+        }
+        m_muLow = low;
+    }
+
+    uint64_t modulus() const { return m_modulus; }
+
+    /// <summary>(high:low) mod n untuk nilai 128-bit &lt; n^2.</summary>
+    uint64_t reduce(uint64_t high, uint64_t low) const {
+        uint64_t p00High, p01High, p10High, p11High;
+        multiplyWide(low, m_muLow, p00High);
+        uint64_t p01Low = multiplyWide(low, m_muHigh, p01High);
+        uint64_t p10Low = multiplyWide(high, m_muLow, p10High);
+        uint64_t p11Low = multiplyWide(high, m_muHigh, p11High);
+        uint64_t middle = p00High + p01Low;
+        uint64_t carry = middle < p00High;
+        middle += p10Low;
+        carry += middle < p10Low;
+        uint64_t quotient = p01High + p10High + p11Low + carry;
+        uint64_t remainder = low - quotient * m_modulus;
+        while (remainder >= m_modulus) remainder -= m_modulus;
+        return remainder;
+    }
+
+    uint64_t multiply(uint64_t a, uint64_t b) const {
+        uint64_t high;
+        uint64_t low = multiplyWide(a, b, high);
+        return reduce(high, low);
+    }
+
+private:
+    uint64_t m_modulus;
+    uint64_t m_muHigh;
+    uint64_t m_muLow;
+};
+
+/// <summary>
+/// 18e) Aritmetika modular untuk modulus tetap saat kompilasi (semua fungsi <c>constexpr</c>).
+/// </summary>
+/// <remarks>
+/// Karena modulus konstanta, kompilator mengganti % dengan perkalian-geser sendiri; dan
+/// tabel kecil (misalnya invers) bisa dihitung pada waktu kompilasi.
+/// </remarks>
+/// <example>
+/// static_assert(FixedModulus&lt;7&gt;::pow(3, 6) == 1, "Fermat");
+/// </example>
+template <uint32_t Modulus>
+struct FixedModulus {
+    static_assert(Modulus > 1, "Modulus harus > 1");
+
+    static constexpr uint32_t modulus = Modulus;
+
+    static constexpr uint32_t add(uint32_t a, uint32_t b) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(a) + b) % Modulus);
+    }
+
+    static constexpr uint32_t subtract(uint32_t a, uint32_t b) {
+        return static_cast<uint32_t>((static_cast<uint64_t>(a) + Modulus - b % Modulus) % Modulus);
+    }
+
+    static constexpr uint32_t multiply(uint32_t a, uint32_t b) {
+        return static_cast<uint32_t>(static_cast<uint64_t>(a) * b % Modulus);
+    }
+
+    static constexpr uint32_t pow(uint32_t base, uint64_t exponent) {
+        uint32_t result = 1 % Modulus;
+        base %= Modulus;
+        while (exponent != 0) {
+            if (exponent & 1) result = multiply(result, base);
+            base = multiply(base, base);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    /// <summary>Invers modular lewat teorema Fermat; hanya sah bila Modulus prima.</summary>
+    static constexpr uint32_t inverse(uint32_t a) { return pow(a, Modulus - 2); }
+};
+
+/// <summary>
+/// 18f) Perpangkatan modular batch: banyak eksponensiasi independen dengan satu modulus ganjil 32-bit.
+/// </summary>
+/// <param name="context">Konteks Montgomery bersama.</param>
+/// <param name="bases">Basis (bentuk biasa).</param>
+/// <param name="exponents">Eksponen.</param>
+/// <param name="results">Keluaran: bases[i]^exponents[i] mod n.</param>
+/// <param name="count">Jumlah elemen.</param>
+/// <remarks>
+/// Elemen diproses per kelompok 8 lajur. Setiap langkah bit mengkuadratkan semua basis dan
+/// memilih perkalian hasil secara tanpa cabang, sehingga loop lajur berbentuk SIMD dan
+/// divektorisasi otomatis; rantai dependensi antar lajur juga saling menutupi latensi.
+/// </remarks>
+void powModBatch(const MontgomeryContext32& context, const uint32_t* bases, const uint64_t* exponents,
+                 uint32_t* results, size_t count) {
+    const size_t lanes = 8;
+    for (size_t begin = 0; begin < count; begin += lanes) {
+        const size_t active = std::min(lanes, count - begin);
+        uint32_t base[lanes], result[lanes];
+        uint64_t exponent[lanes];
+        uint64_t maxExponent = 0;
+        for (size_t l = 0; l < lanes; ++l) {
+            base[l] = l < active ? context.toMontgomery(bases[begin + l]) : context.one();
+            exponent[l] = l < active ? exponents[begin + l] : 0;
+            result[l] = context.one();
+            maxExponent |= exponent[l];
+        }
+        for (; maxExponent != 0; maxExponent >>= 1) {
+            for (size_t l = 0; l < lanes; ++l) {
+                uint32_t product = context.multiply(result[l], base[l]);
+                uint32_t take = 0u - static_cast<uint32_t>(exponent[l] & 1);
+                result[l] = (product & take) | (result[l] & ~take);
+                base[l] = context.multiply(base[l], base[l]);
+                exponent[l] >>= 1;
+            }
+        }
+        for (size_t l = 0; l < active; ++l) results[begin + l] = context.fromMontgomery(result[l]);
+    }
+}
+
+/// <summary>
+/// Perpangkatan modular batch 64-bit: empat lajur independen per langkah dengan konteks Montgomery.
+/// </summary>
+/// <remarks>
+/// Perkalian 64 x 64 -&gt; 128 tidak tersedia sebagai SIMD di x86, jadi lajur diselang-seling
+/// untuk paralelisme tingkat instruksi alih-alih vektor.
+/// </remarks>
+void powModBatch(const MontgomeryContext64& context, const uint64_t* bases, const uint64_t* exponents,
+                 uint64_t* results, size_t count) {
+    const size_t lanes = 4;
+    for (size_t begin = 0; begin < count; begin += lanes) {
+        const size_t active = std::min(lanes, count - begin);
+        uint64_t base[lanes], result[lanes], exponent[lanes];
+        uint64_t maxExponent = 0;
+        for (size_t l = 0; l < lanes; ++l) {
+            base[l] = l < active ? context.toMontgomery(bases[begin + l]) : context.one();
+            exponent[l] = l < active ? exponents[begin + l] : 0;
+            result[l] = context.one();
+            maxExponent |= exponent[l];
+        }
+        for (; maxExponent != 0; maxExponent >>= 1) {
+            for (size_t l = 0; l < lanes; ++l) {
+                uint64_t product = context.multiply(result[l], base[l]);
+                uint64_t take = 0 - (exponent[l] & 1);
+                result[l] = (product & take) | (result[l] & ~take);
+                base[l] = context.multiply(base[l], base[l]);
+                exponent[l] >>= 1;
+            }
+        }
+        for (size_t l = 0; l < active; ++l) results[begin + l] = context.fromMontgomery(result[l]);
+    }
+}
+
+/// <summary>
+/// Uji Miller-Rabin deterministik untuk seluruh bilangan 64-bit.
+/// </summary>
+/// <param name="n">Bilangan ganjil &gt; 2 yang diuji.</param>
+/// <returns>True jika n prima.</returns>
+/// <remarks>
+/// Tujuh basis Jim Sinclair sudah cukup untuk n &lt; 2^64, sehingga hasilnya pasti, bukan probabilistik.
+/// Seluruh aritmetika berjalan dalam bentuk Montgomery (<see cref="MontgomeryContext64"/>).
+/// </remarks>
+bool millerRabin64(uint64_t n) {
+    static const uint64_t bases[] = { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 };
+    const MontgomeryContext64 context(n);
+    const uint64_t one = context.one();
+    const uint64_t minusOne = context.subtract(0, one);
+    uint64_t d = n - 1;
+    unsigned shift = 0;
+    while (d % 2 == 0) {
+        d /= 2;
+        ++shift;
+    }
+    for (uint64_t base : bases) {
+        uint64_t a = base % n;
+        if (a == 0) continue;
+        uint64_t x = context.powMontgomery(context.toMontgomery(a), d);
+        if (x == one || x == minusOne) continue;
+        bool witness = true;
+        for (unsigned r = 1; r < shift && witness; ++r) {
+            x = context.multiply(x, x);
+            if (x == minusOne) witness = false;
+        }
+        if (witness) return false;
+    }
+    return true;
+}
+
+/// <summary>
+/// Kumpulan uji untuk konteks Montgomery, Barrett, <see cref="FixedModulus"/>, dan <see cref="powModBatch"/>.
+/// </summary>
+void testModularArithmetic() {
+    static_assert(FixedModulus<7>::pow(3, 6) == 1, "Teorema kecil Fermat");
+    static_assert(FixedModulus<998244353>::multiply(FixedModulus<998244353>::inverse(2), 2) == 1,
+                  "Invers modular saat kompilasi");
+    assert(FixedModulus<10>::subtract(3, 7) == 6);
+
+    Xoshiro256StarStar rng(58);
+    const uint64_t moduli64[] = { 3, 1000000007, 998244353, kLargestPrime64, UINT64_MAX, (1ull << 63) + 1 };
+    for (uint64_t n : moduli64) {
+        MontgomeryContext64 context(n);
+        for (int i = 0; i < 2000; ++i) {
+            uint64_t a = rng() % n, b = rng() % n;
+            uint64_t product = context.fromMontgomery(
+                context.multiply(context.toMontgomery(a), context.toMontgomery(b)));
+            assert(product == mulMod64(a, b, n));
+        }
+        assert(context.pow(2, n - 1) == powMod64(2, n - 1, n));
+    }
+    for (int i = 0; i < 200; ++i) {
+        uint32_t n = static_cast<uint32_t>(rng()) | 1;
+        if (n == 1) continue;
+        MontgomeryContext32 montgomery(n);
+        BarrettContext32 barrett(n);
+        for (int j = 0; j < 50; ++j) {
+            uint32_t a = static_cast<uint32_t>(rng() % n), b = static_cast<uint32_t>(rng() % n);
+            uint32_t expected = static_cast<uint32_t>(static_cast<uint64_t>(a) * b % n);
+            assert(montgomery.fromMontgomery(montgomery.multiply(montgomery.toMontgomery(a),
+                                                                 montgomery.toMontgomery(b))) == expected);
+            assert(barrett.multiply(a, b) == expected);
+            uint64_t x = rng();
+            assert(barrett.reduce(x) == x % n);
+        }
+    }
+    const uint64_t barrettModuli[] = { 2, 10, 1000000007, (1ull << 62) - 57, (1ull << 61) - 1 };
+    for (uint64_t n : barrettModuli) {
+        BarrettContext64 barrett(n);
+        for (int i = 0; i < 2000; ++i) {
+            uint64_t a = rng() % n, b = rng() % n;
+            assert(barrett.multiply(a, b) == mulMod64(a, b, n));
+        }
+    }
+
+    std::vector<uint32_t> bases32(37), results32(37);
+    std::vector<uint64_t> exponents(37), bases64(37), results64(37);
+    for (size_t i = 0; i < bases32.size(); ++i) {
+        bases32[i] = static_cast<uint32_t>(rng());
+        bases64[i] = rng();
+        exponents[i] = i == 5 ? 0 : rng() >> (i % 64);
+    }
+    MontgomeryContext32 context32(4294967291u);
+    MontgomeryContext64 context64(kLargestPrime64);
+    powModBatch(context32, bases32.data(), exponents.data(), results32.data(), bases32.size());
+    powModBatch(context64, bases64.data(), exponents.data(), results64.data(), bases64.size());
+    for (size_t i = 0; i < bases32.size(); ++i) {
+        assert(results32[i] == powMod64(bases32[i], exponents[i], 4294967291u));
+        assert(results64[i] == powMod64(bases64[i], exponents[i], kLargestPrime64));
+    }
+
+    try {
+        MontgomeryContext64 even(10);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji aritmetika modular lulus!\n";
+}
+
+/// <summary>Modulus NTT-friendly 998244353 = 119 * 2^23 + 1 (akar primitif 3).</summary>
+const uint32_t kNttFriendlyModulus = 998244353;
+
+/// <summary>
+/// Perkalian polinomial dengan koefisien mod <paramref name="modulus"/>.
+/// </summary>
+/// <param name="a">Koefisien polinomial pertama (pangkat naik).</param>
+/// <param name="b">Koefisien polinomial kedua (pangkat naik).</param>
+/// <param name="modulus">Modulus koefisien, &gt;= 2.</param>
+/// <returns>Koefisien a*b mod modulus.</returns>
+/// <remarks>
+/// Untuk <see cref="kNttFriendlyModulus"/> dan polinomial besar dipakai konvolusi NTT
+/// O(k log k); modulus lain memakai schoolbook dengan reduksi Barrett.
+/// </remarks>
+std::vector<uint32_t> multiplyPolynomials(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b,
+                                          uint32_t modulus) {
+    if (a.empty() || b.empty()) return std::vector<uint32_t>();
+    const size_t resultSize = a.size() + b.size() - 1;
+    if (modulus == kNttFriendlyModulus && std::min(a.size(), b.size()) > 32) {
+        size_t size = 1;
+        while (size < resultSize) size <<= 1;
+        NttPlan plan(size, kNttFriendlyModulus, 3);
+        std::vector<uint64_t> fa(a.begin(), a.end()), fb(b.begin(), b.end());
+        fa.resize(size, 0);
+        fb.resize(size, 0);
+        plan.forward(fa);
+        plan.forward(fb);
+        for (size_t i = 0; i < size; ++i) fa[i] = fa[i] * fb[i] % kNttFriendlyModulus;
+        plan.inverse(fa);
+        return std::vector<uint32_t>(fa.begin(), fa.begin() + resultSize);
+    }
+    const BarrettContext32 barrett(modulus);
+    std::vector<uint64_t> accumulator(resultSize, 0);
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (size_t j = 0; j < b.size(); ++j) {
+            // Akumulator &lt; m dan a[i] * b[j] &lt; m^2, jadi jumlahnya muat 64-bit.
+            accumulator[i + j] = barrett.reduce(accumulator[i + j] + static_cast<uint64_t>(a[i]) * b[j]);
+        }
+    }
+    return std::vector<uint32_t>(accumulator.begin(), accumulator.end());
+}
+
+/// <summary>
+/// 19) Rekurensi linear orde-k mod m: a(n) = c1*a(n-1) + c2*a(n-2) + ... + ck*a(n-k).
+/// </summary>
+/// <remarks>
+/// Generalisasi dari <see cref="fibonacci"/> (c = {1, 1}, suku awal {0, 1}) untuk Tribonacci,
+/// Lucas, dan rekurensi orde-k lain. Suku ke-n dihitung dengan Kitamasa (x^n mod polinomial
+/// karakteristik) untuk k kecil, atau Bostan-Mori dengan perkalian NTT untuk k besar,
+/// keduanya O(M(k) log n) dengan M(k) biaya perkalian polinomial.
+/// </remarks>
+/// <example>
+/// LinearRecurrence lucas({ 1, 1 }, { 2, 1 }, 1000000007);
+/// lucas.term(10)  // 123
+/// </example>
+class LinearRecurrence {
+public:
+    /// <summary>Orde maksimum yang masih memakai Kitamasa pada <see cref="term"/>.</summary>
+    static const size_t kKitamasaMaxOrder = 32;
+
+    /// <param name="coefficients">c1..ck.</param>
+    /// <param name="initialTerms">a(0)..a(k-1).</param>
+    /// <param name="modulus">Modulus, &gt;= 2 (prima hanya diperlukan oleh Berlekamp-Massey).</param>
+    /// <exception cref="std::invalid_argument">Dilempar bila ukuran tidak sama atau modulus &lt; 2.</exception>
+    LinearRecurrence(std::vector<uint32_t> coefficients, std::vector<uint32_t> initialTerms, uint32_t modulus)
+        : m_coefficients(std::move(coefficients)), m_initialTerms(std::move(initialTerms)), m_modulus(modulus) {
+        if (m_coefficients.size() != m_initialTerms.size()) {
+            throw std::invalid_argument("Jumlah koefisien harus sama dengan jumlah suku awal");
+        }
+        if (modulus < 2) {
+            throw std::invalid_argument("Modulus harus >= 2");
+        }
+        for (uint32_t& c : m_coefficients) c %= modulus;
+        for (uint32_t& a : m_initialTerms) a %= modulus;
+    }
+
+    size_t order() const { return m_coefficients.size(); }
+    uint32_t modulus() const { return m_modulus; }
+    const std::vector<uint32_t>& coefficients() const { return m_coefficients; }
+
+    /// <summary>Suku ke-n dengan algoritma yang dipilih otomatis berdasarkan orde.</summary>
+    uint32_t term(uint64_t n) const {
+        return order() <= kKitamasaMaxOrder ? termKitamasa(n) : termBostanMori(n);
+    }
+
+    /// <summary>Suku ke-n lewat x^n mod polinomial karakteristik (Kitamasa).</summary>
+    uint32_t termKitamasa(uint64_t n) const {
+        const size_t k = order();
+        if (k == 0) return 0;
+        if (n < k) return m_initialTerms[static_cast<size_t>(n)];
+        std::vector<uint32_t> result(1, 1);   // x^0
+        std::vector<uint32_t> base(2, 0);     // x^1
+        base[1] = 1;
+        if (k == 1) base = std::vector<uint32_t>(1, m_coefficients[0]);
+        for (; n != 0; n >>= 1) {
+            if (n & 1) result = reduceByCharacteristic(multiplyPolynomials(result, base, m_modulus));
+            base = reduceByCharacteristic(multiplyPolynomials(base, base, m_modulus));
+        }
+        const BarrettContext32 barrett(m_modulus);
+        uint64_t value = 0;
+        for (size_t i = 0; i < result.size(); ++i) {
+            value = barrett.reduce(value + static_cast<uint64_t>(result[i]) * m_initialTerms[i]);
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    /// <summary>Suku ke-n lewat algoritma Bostan-Mori: [x^n] P(x)/Q(x).</summary>
+    uint32_t termBostanMori(uint64_t n) const {
+        const size_t k = order();
+        if (k == 0) return 0;
+        // Q(x) = 1 - c1 x - ... - ck x^k, P(x) = A(x) Q(x) mod x^k.
+        std::vector<uint32_t> q(k + 1);
+        q[0] = 1;
+        for (size_t i = 0; i < k; ++i) q[i + 1] = m_coefficients[i] == 0 ? 0 : m_modulus - m_coefficients[i];
+        std::vector<uint32_t> p = multiplyPolynomials(m_initialTerms, q, m_modulus);
+        p.resize(k);
+        for (; n != 0; n >>= 1) {
+            std::vector<uint32_t> qNegated = q;
+            for (size_t i = 1; i < qNegated.size(); i += 2) {
+                qNegated[i] = qNegated[i] == 0 ? 0 : m_modulus - qNegated[i];
+            }
+            std::vector<uint32_t> u = multiplyPolynomials(p, qNegated, m_modulus);
+            std::vector<uint32_t> v = multiplyPolynomials(q, qNegated, m_modulus);
+            for (size_t i = 0; i < k; ++i) {
+                size_t index = 2 * i + (n & 1);
+                p[i] = index < u.size() ? u[index] : 0;
+            }
+            for (size_t i = 0; i <= k; ++i) q[i] = 2 * i < v.size() ? v[2 * i] : 0;
+        }
+        return p[0]; // Q(0) selalu 1
+    }
+
+    /// <summary>
+    /// Berlekamp-Massey: rekurensi terpendek yang menghasilkan sampel barisan mod prima.
+    /// </summary>
+    /// <param name="samples">Suku-suku awal barisan; 2k suku cukup untuk rekurensi orde k.</param>
+    /// <param name="primeModulus">Modulus prima.</param>
+    /// <returns>Rekurensi dengan suku awal diambil dari sampel.</returns>
+    static LinearRecurrence berlekampMassey(const std::vector<uint32_t>& samples, uint32_t primeModulus) {
+        const uint64_t p = primeModulus;
+        std::vector<uint64_t> current(1, 1), previous(1, 1);
+        size_t length = 0, gap = 1;
+        uint64_t previousDiscrepancy = 1;
+        for (size_t n = 0; n < samples.size(); ++n) {
+            uint64_t discrepancy = samples[n] % p;
+            for (size_t i = 1; i <= length; ++i) {
+                discrepancy = (discrepancy + current[i] * (samples[n - i] % p)) % p;
+            }
+            if (discrepancy == 0) {
+                ++gap;
+                continue;
+            }
+            const uint64_t scale = discrepancy * powMod64(previousDiscrepancy, p - 2, p) % p;
+            std::vector<uint64_t> updated = current;
+            if (updated.size() < previous.size() + gap) updated.resize(previous.size() + gap, 0);
+            for (size_t i = 0; i < previous.size(); ++i) {
+                updated[i + gap] = (updated[i + gap] + p - scale * previous[i] % p) % p;
+            }
+            if (2 * length <= n) {
+                previous = current;
+                length = n + 1 - length;
+                previousDiscrepancy = discrepancy;
+                gap = 1;
+            }
+            else {
+                ++gap;
+            }
+            current = updated;
+        }
+        std::vector<uint32_t> coefficients(length), initial(length);
+        for (size_t i = 0; i < length; ++i) {
+            uint64_t c = i + 1 < current.size() ? current[i + 1] : 0;
+            coefficients[i] = static_cast<uint32_t>((p - c) % p);
+            initial[i] = static_cast<uint32_t>(samples[i] % p);
+        }
+        return LinearRecurrence(std::move(coefficients), std::move(initial), primeModulus);
+    }
+
+private:
+    /// <summary>Sisa bagi polinomial dengan x^k - c1 x^(k-1) - ... - ck.</summary>
+    std::vector<uint32_t> reduceByCharacteristic(std::vector<uint32_t> poly) const {
+        const size_t k = order();
+        const BarrettContext32 barrett(m_modulus);
+        for (size_t degree = poly.size(); degree-- > k;) {
+            const uint64_t lead = poly[degree];
+            if (lead == 0) continue;
+            // x^degree = sum c_i x^(degree - i)
+            for (size_t i = 1; i <= k; ++i) {
+                poly[degree - i] = barrett.reduce(poly[degree - i] + lead * m_coefficients[i - 1]);
+            }
+        }
+        poly.resize(std::min(poly.size(), k));
+        return poly;
+    }
+
+    std::vector<uint32_t> m_coefficients;
+    std::vector<uint32_t> m_initialTerms;
+    uint32_t m_modulus;
+};
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="LinearRecurrence"/>: Fibonacci, Lucas, Tribonacci, orde besar, dan Berlekamp-Massey.
+/// </summary>
+void testLinearRecurrence() {
+    LinearRecurrence fib({ 1, 1 }, { 0, 1 }, 4294967291u);
+    for (int n = 0; n <= 46; ++n) {
+        assert(fib.term(n) == static_cast<uint32_t>(fibonacci(n)));
+        assert(fib.termBostanMori(n) == static_cast<uint32_t>(fibonacci(n)));
+    }
+    LinearRecurrence lucas({ 1, 1 }, { 2, 1 }, 1000000007);
+    assert(lucas.term(10) == 123);
+    LinearRecurrence tribonacci({ 1, 1, 1 }, { 0, 0, 1 }, 1000000007);
+    assert(tribonacci.term(10) == 81);
+    assert(tribonacci.term(1000000000000ull) == tribonacci.termBostanMori(1000000000000ull));
+    LinearRecurrence powersOfThree({ 3 }, { 1 }, 1000000007);
+    assert(powersOfThree.term(100) == powMod64(3, 100, 1000000007));
+
+    // Orde besar: Kitamasa, Bostan-Mori, dan iterasi langsung harus sepakat.
+    Xoshiro256StarStar rng(59);
+    std::vector<uint32_t> coefficients(80), initial(80);
+    for (size_t i = 0; i < coefficients.size(); ++i) {
+        coefficients[i] = static_cast<uint32_t>(rng() % kNttFriendlyModulus);
+        initial[i] = static_cast<uint32_t>(rng() % kNttFriendlyModulus);
+    }
+    LinearRecurrence large(coefficients, initial, kNttFriendlyModulus);
+    std::vector<uint64_t> sequence(initial.begin(), initial.end());
+    for (size_t n = 80; n < 400; ++n) {
+        uint64_t value = 0;
+        for (size_t i = 0; i < 80; ++i) value = (value + coefficients[i] * sequence[n - 1 - i]) % kNttFriendlyModulus;
+        sequence.push_back(value);
+    }
+    for (size_t n : { 0, 79, 80, 81, 250, 399 }) {
+        assert(large.termKitamasa(n) == sequence[n]);
+        assert(large.termBostanMori(n) == sequence[n]);
+    }
+    assert(large.termKitamasa(1000000000000000000ull) == large.termBostanMori(1000000000000000000ull));
+
+    // Berlekamp-Massey memulihkan rekurensi dari 2k sampel.
+    std::vector<uint32_t> samples(sequence.begin(), sequence.begin() + 160);
+    LinearRecurrence recovered = LinearRecurrence::berlekampMassey(samples, kNttFriendlyModulus);
+    assert(recovered.order() == 80 && recovered.coefficients() == coefficients);
+    assert(recovered.term(399) == sequence[399]);
+    std::vector<uint32_t> fibSamples;
+    for (int n = 0; n < 10; ++n) fibSamples.push_back(static_cast<uint32_t>(fibonacci(n)));
+    LinearRecurrence fibRecovered = LinearRecurrence::berlekampMassey(fibSamples, 1000000007);
+    assert((fibRecovered.coefficients() == std::vector<uint32_t>{ 1, 1 }));
+
+    try {
+        LinearRecurrence invalid({ 1, 1 }, { 0 }, 7);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji rekurensi linear lulus!\n";
+}
+
+/// <summary>
+/// Jumlah bit nol di ujung bawah kata 64-bit.
+/// </summary>
+/// <param name="x">Kata bukan nol.</param>
+/// <returns>Indeks bit 1 terendah.</returns>
+inline unsigned countTrailingZeros64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<unsigned>(index);
+#else
+    unsigned count = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/// <summary>Indeks Fibonacci terbesar yang muat 64-bit: F(93).</summary>
+const unsigned kMaxFibonacciIndex64 = 93;
+
+/// <summary>
+/// Tabel F(0)..F(93) dengan padding UINT64_MAX hingga 128 entri untuk pencarian biner tanpa cabang.
+/// </summary>
+const uint64_t* fibonacciTable64() {
+    static const std::vector<uint64_t> table = [] {
+        std::vector<uint64_t> values(128, UINT64_MAX);
+        values[0] = 0;
+        values[1] = 1;
+        for (unsigned i = 2; i <= kMaxFibonacciIndex64; ++i) values[i] = values[i - 1] + values[i - 2];
+        return values;
+    }();
+    return table.data();
+}
+
+/// <summary>
+/// Indeks terbesar i &lt;= 93 dengan F(i) &lt;= n pada tabel 128 entri, tanpa percabangan.
+/// </summary>
+/// <remarks>Padding UINT64_MAX hanya tercapai untuk n = UINT64_MAX, sehingga hasil dipotong ke F(93).</remarks>
+inline unsigned fibonacciFloorIndex(const uint64_t* table, uint64_t n) {
+    unsigned base = 0;
+    for (unsigned half = 64; half != 0; half >>= 1) {
+        base = (table[base + half] <= n) ? base + half : base;
+    }
+    return base < kMaxFibonacciIndex64 ? base : kMaxFibonacciIndex64;
+}
+
+/// <summary>
+/// 20a) Mengecek apakah n bilangan Fibonacci lewat tabel 64-bit.
+/// </summary>
+/// <param name="n">Nilai yang diuji.</param>
+/// <returns>True jika n = F(k) untuk suatu k.</returns>
+/// <remarks>
+/// Tujuh langkah pencarian biner tanpa cabang (cmov) pada tabel yang muat di L1, menggantikan
+/// pembangkitan barisan dengan <see cref="fibonacci"/> untuk setiap nilai.
+/// </remarks>
+bool isFibonacci(uint64_t n) {
+    const uint64_t* table = fibonacciTable64();
+    return table[fibonacciFloorIndex(table, n)] == n;
+}
+
+/// <summary>
+/// Bentuk batch <see cref="isFibonacci"/>.
+/// </summary>
+/// <param name="values">Nilai yang diuji.</param>
+/// <param name="count">Jumlah nilai.</param>
+/// <param name="results">Keluaran: 1 bila Fibonacci, selain itu 0.</param>
+/// <remarks>Setiap lajur melakukan pencarian yang sama panjangnya, sehingga loop dapat divektorisasi.</remarks>
+void isFibonacciBatch(const uint64_t* values, size_t count, uint8_t* results) {
+    const uint64_t* table = fibonacciTable64();
+    for (size_t i = 0; i < count; ++i) {
+        results[i] = static_cast<uint8_t>(table[fibonacciFloorIndex(table, values[i])] == values[i]);
+    }
+}
+
+/// <summary>
+/// Representasi Zeckendorf: bit i menyatakan F(i + 2) ikut dijumlahkan.
+/// </summary>
+/// <remarks>Seluruh nilai 64-bit memerlukan 92 bit (F(2)..F(93)), sehingga disimpan dalam dua kata.</remarks>
+struct ZeckendorfCode {
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    bool operator==(const ZeckendorfCode& other) const { return low == other.low && high == other.high; }
+};
+
+/// <summary>
+/// 20b) Dekomposisi Zeckendorf: n sebagai jumlah bilangan Fibonacci tak berurutan.
+/// </summary>
+/// <param name="n">Nilai yang dikodekan.</param>
+/// <returns>Kode dengan tidak ada dua bit bersebelahan yang sama-sama 1.</returns>
+/// <example>
+/// zeckendorfEncode(100)  // 89 + 8 + 3 = F(11) + F(6) + F(4)
+/// </example>
+ZeckendorfCode zeckendorfEncode(uint64_t n) {
+    const uint64_t* table = fibonacciTable64();
+    ZeckendorfCode code;
+    while (n != 0) {
+        unsigned index = fibonacciFloorIndex(table, n);
+        n -= table[index];
+        unsigned bit = index - 2;
+        if (bit < 64) code.low |= 1ull << bit;
+        else code.high |= 1ull << (bit - 64);
+    }
+    return code;
+}
+
+/// <summary>
+/// Kebalikan <see cref="zeckendorfEncode"/>.
+/// </summary>
+/// <param name="code">Kode Zeckendorf.</param>
+/// <returns>Jumlah F(i + 2) untuk setiap bit i yang menyala.</returns>
+uint64_t zeckendorfDecode(const ZeckendorfCode& code) {
+    const uint64_t* table = fibonacciTable64();
+    uint64_t value = 0;
+    for (uint64_t bits = code.low; bits != 0; bits &= bits - 1) value += table[countTrailingZeros64(bits) + 2];
+    for (uint64_t bits = code.high; bits != 0; bits &= bits - 1) value += table[countTrailingZeros64(bits) + 66];
+    return value;
+}
+
+/// <summary>Bentuk batch <see cref="zeckendorfEncode"/>.</summary>
+void zeckendorfEncodeBatch(const uint64_t* values, size_t count, ZeckendorfCode* codes) {
+    for (size_t i = 0; i < count; ++i) codes[i] = zeckendorfEncode(values[i]);
+}
+
+/// <summary>Bentuk batch <see cref="zeckendorfDecode"/>.</summary>
+void zeckendorfDecodeBatch(const ZeckendorfCode* codes, size_t count, uint64_t* values) {
+    for (size_t i = 0; i < count; ++i) values[i] = zeckendorfDecode(codes[i]);
+}
+
+/// <summary>
+/// Pengodean Fibonacci untuk kompresi: setiap nilai ditulis sebagai bit Zeckendorf dari
+/// (nilai + 1), bit rendah dahulu, diakhiri bit 1 tambahan sehingga pola "11" menjadi pemisah.
+/// </summary>
+/// <param name="values">Nilai yang dikodekan, masing-masing &lt; UINT64_MAX.</param>
+/// <returns>Aliran bit yang dipadatkan ke byte (bit 0 setiap byte lebih dulu).</returns>
+/// <exception cref="std::invalid_argument">Dilempar bila ada nilai UINT64_MAX.</exception>
+/// <remarks>Nilai kecil memakai sedikit bit, jadi cocok untuk data yang didominasi bilangan kecil.</remarks>
+std::vector<uint8_t> fibonacciCodeEncode(const std::vector<uint64_t>& values) {
+    std::vector<uint8_t> bytes;
+    uint64_t bitCount = 0;
+    auto pushBit = [&](bool bit) {
+        if (bitCount % 8 == 0) bytes.push_back(0);
+        if (bit) bytes.back() |= static_cast<uint8_t>(1u << (bitCount % 8));
+        ++bitCount;
+    };
+    for (uint64_t value : values) {
+        if (value == UINT64_MAX) {
+            throw std::invalid_argument("Nilai terlalu besar untuk kode Fibonacci");
+        }
+        ZeckendorfCode code = zeckendorfEncode(value + 1);
+        unsigned top = code.high != 0 ? 127 : 63;
+        while (!(top >= 64 ? (code.high >> (top - 64)) & 1 : (code.low >> top) & 1)) --top;
+        for (unsigned bit = 0; bit <= top; ++bit) {
+            pushBit(bit >= 64 ? (code.high >> (bit - 64)) & 1 : (code.low >> bit) & 1);
+        }
+        pushBit(true);
+    }
+    return bytes;
+}
+
+/// <summary>
+/// Kebalikan <see cref="fibonacciCodeEncode"/>.
+/// </summary>
+/// <param name="bytes">Aliran bit hasil pengodean.</param>
+/// <returns>Nilai-nilai asli.</returns>
+/// <exception cref="std::invalid_argument">
+/// Dilempar bila ada bit di atas posisi 91 (F(93)) atau nilai melampaui 64-bit.
+/// </exception>
+std::vector<uint64_t> fibonacciCodeDecode(const std::vector<uint8_t>& bytes) {
+    const uint64_t* table = fibonacciTable64();
+    std::vector<uint64_t> values;
+    uint64_t current = 0;
+    unsigned position = 0;
+    bool previous = false;
+    for (size_t i = 0; i < 8 * bytes.size(); ++i) {
+        bool bit = (bytes[i / 8] >> (i % 8)) & 1;
+        if (bit && previous) {
+            values.push_back(current - 1);
+            current = 0;
+            position = 0;
+            previous = false;
+            continue;
+        }
+        if (bit) {
+            if (position + 2 > kMaxFibonacciIndex64 || current > UINT64_MAX - table[position + 2]) {
+                throw std::invalid_argument("Kode Fibonacci tidak valid");
+            }
+            current += table[position + 2];
+        }
+        previous = bit;
+        ++position;
+    }
+    return values;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="isFibonacci"/>, Zeckendorf, dan pengodean Fibonacci.
+/// </summary>
+void testFibonacciQueries() {
+    const uint64_t* table = fibonacciTable64();
+    assert(table[kMaxFibonacciIndex64] == 12200160415121876738ull);
+    for (unsigned k = 0; k <= kMaxFibonacciIndex64; ++k) {
+        assert(isFibonacci(table[k]));
+        if (k >= 4) assert(!isFibonacci(table[k] + 1));
+    }
+    for (int n = 0; n <= 46; ++n) assert(isFibonacci(static_cast<uint64_t>(fibonacci(n))));
+    assert(!isFibonacci(4) && !isFibonacci(UINT64_MAX));
+
+    std::vector<uint64_t> values = { 0, 1, 4, 89, 90, 144, UINT64_MAX, 12200160415121876738ull };
+    std::vector<uint8_t> flags(values.size());
+    isFibonacciBatch(values.data(), values.size(), flags.data());
+    assert((flags == std::vector<uint8_t>{ 1, 1, 0, 1, 0, 1, 0, 1 }));
+
+    ZeckendorfCode hundred = zeckendorfEncode(100);
+    assert(hundred.low == ((1ull << 9) | (1ull << 4) | (1ull << 2)) && hundred.high == 0);
+    assert(zeckendorfDecode(hundred) == 100);
+
+    Xoshiro256StarStar rng(60);
+    std::vector<uint64_t> samples = { 0, 1, 2, UINT64_MAX, 12200160415121876738ull };
+    for (int i = 0; i < 2000; ++i) samples.push_back(rng() >> (i % 64));
+    std::vector<ZeckendorfCode> codes(samples.size());
+    std::vector<uint64_t> decoded(samples.size());
+    zeckendorfEncodeBatch(samples.data(), samples.size(), codes.data());
+    zeckendorfDecodeBatch(codes.data(), codes.size(), decoded.data());
+    assert(decoded == samples);
+    for (size_t i = 0; i < codes.size(); ++i) {
+        const ZeckendorfCode& code = codes[i];
+        // Tidak boleh ada dua bit bersebelahan, termasuk di batas kata; bit tertinggi F(93) = bit 91.
+        assert((code.low & (code.low << 1)) == 0 && (code.high & (code.high << 1)) == 0);
+        assert(!((code.low >> 63) & code.high & 1));
+        assert(code.high < (1ull << 28));
+        // Jumlahkan ulang dengan barisan Fibonacci sebenarnya, bukan tabel ber-padding.
+        uint64_t sum = 0, previous = 0, current = 1;
+        for (unsigned bit = 0; bit < 92; ++bit) {
+            const uint64_t next = previous + current; // F(bit + 2)
+            previous = current;
+            current = next;
+            if (bit < 64 ? (code.low >> bit) & 1 : (code.high >> (bit - 64)) & 1) sum += next;
+        }
+        assert(sum == samples[i]);
+    }
+    const ZeckendorfCode largest = zeckendorfEncode(UINT64_MAX);
+    assert(largest.high >> 27 == 1); // F(93) ikut dijumlahkan
+
+    samples.pop_back();
+    samples.erase(samples.begin() + 3);
+    std::vector<uint8_t> stream = fibonacciCodeEncode(samples);
+    assert(fibonacciCodeDecode(stream) == samples);
+    assert(fibonacciCodeEncode({ 0, 1, 2 }).size() == 2); // "11" + "011" + "0011" = 9 bit
+    try {
+        fibonacciCodeEncode({ UINT64_MAX });
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+    try {
+        std::vector<uint8_t> beyond(13, 0);
+        beyond[11] = 0x10; // bit 92
+        beyond[12] = 0x03;
+        fibonacciCodeDecode(beyond);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji kueri Fibonacci lulus!\n";
+}
+
+/// <summary>
+/// 21a) Barisan malas F(0), F(1), ..., F(count - 1) dalam 64-bit.
+/// </summary>
+/// <remarks>
+/// Iterator membawa state (F(i), F(i+1)) sehingga setiap langkah O(1), bukan memanggil
+/// <see cref="fibonacci"/> per indeks yang totalnya O(n^2). begin()/end() bertipe sama,
+/// jadi dapat dipakai dengan algoritma standar dan adaptor range.
+/// </remarks>
+/// <example>
+/// for (uint64_t f : FibonacciSequence(10)) { ... }  // 0 1 1 2 3 5 8 13 21 34
+/// </example>
+class FibonacciSequence {
+public:
+    /// <summary>Jumlah maksimum suku yang muat 64-bit (F(0)..F(93)).</summary>
+    static const size_t kMaxCount = kMaxFibonacciIndex64 + 1;
+
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const uint64_t*;
+        using reference = uint64_t;
+
+        iterator() {}
+        explicit iterator(size_t index) : m_index(index) {}
+
+        uint64_t operator*() const { return m_current; }
+        iterator& operator++() {
+            uint64_t next = m_current + m_next;
+            m_current = m_next;
+            m_next = next;
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        size_t m_index = 0;
+        uint64_t m_current = 0;
+        uint64_t m_next = 1;
+    };
+
+    /// <exception cref="std::invalid_argument">Dilempar bila count &gt; <see cref="kMaxCount"/>.</exception>
+    explicit FibonacciSequence(size_t count = kMaxCount) : m_count(count) {
+        if (count > kMaxCount) {
+            throw std::invalid_argument("Suku Fibonacci melampaui 64-bit");
+        }
+    }
+
+    iterator begin() const { return iterator(0); }
+    iterator end() const { return iterator(m_count); }
+
+private:
+    size_t m_count;
+};
+
+/// <summary>
+/// 21b) Barisan malas 0!, 1!, ..., (count - 1)! dalam 64-bit.
+/// </summary>
+/// <remarks>Setiap langkah satu perkalian; 20! adalah faktorial terakhir yang muat 64-bit.</remarks>
+class FactorialSequence {
+public:
+    static const size_t kMaxCount = 21;
+
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = uint64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const uint64_t*;
+        using reference = uint64_t;
+
+        iterator() {}
+        explicit iterator(size_t index) : m_index(index) {}
+
+        uint64_t operator*() const { return m_current; }
+        iterator& operator++() {
+            ++m_index;
+            m_current *= m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        size_t m_index = 0;
+        uint64_t m_current = 1;
+    };
+
+    /// <exception cref="std::invalid_argument">Dilempar bila count &gt; <see cref="kMaxCount"/>.</exception>
+    explicit FactorialSequence(size_t count = kMaxCount) : m_count(count) {
+        if (count > kMaxCount) {
+            throw std::invalid_argument("Faktorial melampaui 64-bit");
+        }
+    }
+
+    iterator begin() const { return iterator(0); }
+    iterator end() const { return iterator(m_count); }
+
+private:
+    size_t m_count;
+};
+
+/// <summary>
+/// 21c) Barisan malas Fibonacci berpresisi sembarang yang memakai ulang buffer limb.
+/// </summary>
+/// <remarks>
+/// State dua <see cref="BigUnsigned"/> disimpan di objek barisan; setiap langkah menambah di
+/// tempat lalu menukar, sehingga alokasi hanya terjadi saat kapasitas limb perlu tumbuh.
+/// Barisan ini sekali jalan (single-pass) seperti <c>std::istream_iterator</c>: nilai yang
+/// dirujuk iterator berubah saat iterator dimajukan.
+/// </remarks>
+class FibonacciBigSequence {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = BigUnsigned;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const BigUnsigned*;
+        using reference = const BigUnsigned&;
+
+        iterator() {}
+        iterator(FibonacciBigSequence* owner, size_t index) : m_owner(owner), m_index(index) {}
+
+        const BigUnsigned& operator*() const { return m_owner->m_current; }
+        iterator& operator++() {
+            m_owner->m_next += m_owner->m_current;
+            std::swap(m_owner->m_current, m_owner->m_next);
+            ++m_index;
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        FibonacciBigSequence* m_owner = nullptr;
+        size_t m_index = 0;
+    };
+
+    explicit FibonacciBigSequence(size_t count) : m_count(count), m_current(0), m_next(1) {}
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_count); }
+
+private:
+    size_t m_count;
+    BigUnsigned m_current;
+    BigUnsigned m_next;
+};
+
+/// <summary>
+/// 21d) Barisan malas faktorial berpresisi sembarang dengan perkalian di tempat.
+/// </summary>
+/// <remarks>Sekali jalan, sama seperti <see cref="FibonacciBigSequence"/>.</remarks>
+class FactorialBigSequence {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = BigUnsigned;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const BigUnsigned*;
+        using reference = const BigUnsigned&;
+
+        iterator() {}
+        iterator(FactorialBigSequence* owner, size_t index) : m_owner(owner), m_index(index) {}
+
+        const BigUnsigned& operator*() const { return m_owner->m_current; }
+        iterator& operator++() {
+            ++m_index;
+            m_owner->m_current.multiplySmallInPlace(static_cast<uint32_t>(m_index));
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        FactorialBigSequence* m_owner = nullptr;
+        size_t m_index = 0;
+    };
+
+    /// <exception cref="std::invalid_argument">Dilempar bila count melebihi 2^32.</exception>
+    explicit FactorialBigSequence(size_t count) : m_count(count), m_current(1) {
+        if (count > (1ull << 32)) {
+            throw std::invalid_argument("Faktor faktorial harus muat 32-bit");
+        }
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_count); }
+
+private:
+    size_t m_count;
+    BigUnsigned m_current;
+};
+
+/// <summary>
+/// Kumpulan uji untuk generator barisan malas Fibonacci dan faktorial.
+/// </summary>
+void testSequenceGenerators() {
+    int index = 0;
+    for (uint64_t f : FibonacciSequence(47)) {
+        assert(f == static_cast<uint64_t>(fibonacci(index++)));
+    }
+    assert(index == 47);
+    FibonacciSequence all;
+    assert(std::distance(all.begin(), all.end()) == 94);
+    uint64_t last = 0;
+    for (uint64_t f : all) last = f;
+    assert(last == 12200160415121876738ull);
+    FibonacciSequence::iterator firstOver1000 =
+        std::find_if(all.begin(), all.end(), [](uint64_t f) { return f > 1000; });
+    assert(*firstOver1000 == 1597);
+
+    index = 0;
+    for (uint64_t f : FactorialSequence(13)) {
+        assert(f == static_cast<uint64_t>(factorial(index++)));
+    }
+    FactorialSequence factorials;
+    std::vector<uint64_t> collected(factorials.begin(), factorials.end());
+    assert(collected.size() == 21 && collected.back() == 2432902008176640000ull);
+
+    FibonacciBigSequence bigFibonacci(301);
+    index = 0;
+    for (const BigUnsigned& f : bigFibonacci) {
+        if (index == 100) assert(f.toString() == "354224848179261915075");
+        if (index == 300) assert(f == fibonacciBig(300));
+        ++index;
+    }
+    assert(index == 301);
+
+    FactorialBigSequence bigFactorial(101);
+    index = 0;
+    for (const BigUnsigned& f : bigFactorial) {
+        if (index == 25) assert(f.toString() == "15511210043330985984000000");
+        if (index == 100) assert(f == factorialBig(100));
+        ++index;
+    }
+
+    try {
+        FactorialSequence tooLong(22);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji generator barisan lulus!\n";
+}
+
+/// <summary>
+/// Jumlah bit nol di ujung atas kata 64-bit.
+/// </summary>
+/// <param name="x">Kata bukan nol.</param>
+/// <returns>63 dikurangi indeks bit 1 tertinggi.</returns>
+inline unsigned countLeadingZeros64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_clzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return 63 - static_cast<unsigned>(index);
+#else
+    unsigned count = 0;
+    while ((x & 0x8000000000000000ull) == 0) {
+        x <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/// <summary>
+/// 22) Tabel memo append-only yang aman lintas thread dan diperpanjang sesuai permintaan.
+/// </summary>
+/// <typeparam name="T">Tipe nilai; harus dapat dikonstruksi default dan di-assign.</typeparam>
+/// <remarks>
+/// Entri disimpan dalam chunk berukuran geometris (chunk k memuat kFirstChunk * 2^k entri)
+/// yang tidak pernah dipindah, sehingga referensi ke entri tetap sah selama tabel hidup.
+/// Pembaca bebas tunggu (wait-free): cukup satu load acquire panjang terpublikasi lalu
+/// membaca entri. Penulis memperpanjang tabel secara massal (minimal dua kali lipat) di
+/// bawah mutex lalu mempublikasikan panjang baru dengan store release.
+/// </remarks>
+template <typename T>
+class ConcurrentMemoTable {
+public:
+    /// <summary>
+    /// Fungsi langkah: menghitung entri ke-index; entri &lt; index boleh dibaca lewat <see cref="entry"/>.
+    /// </summary>
+    using Step = std::function<T(size_t index, const ConcurrentMemoTable& table)>;
+
+    explicit ConcurrentMemoTable(Step step) : m_step(std::move(step)), m_length(0) {
+        for (std::atomic<T*>& chunk : m_chunks) chunk.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~ConcurrentMemoTable() {
+        for (std::atomic<T*>& chunk : m_chunks) delete[] chunk.load(std::memory_order_relaxed);
+    }
+
+    ConcurrentMemoTable(const ConcurrentMemoTable&) = delete;
+    ConcurrentMemoTable& operator=(const ConcurrentMemoTable&) = delete;
+
+    /// <summary>
+    /// Nilai ke-index; memperpanjang tabel bila belum tersedia.
+    /// </summary>
+    /// <param name="index">Indeks entri.</param>
+    /// <returns>Referensi stabil ke entri.</returns>
+    const T& get(size_t index) {
+        if (index >= m_length.load(std::memory_order_acquire)) {
+            extendTo(index + 1);
+        }
+        return entry(index);
+    }
+
+    /// <summary>Banyak entri yang sudah dipublikasikan.</summary>
+    size_t size() const { return m_length.load(std::memory_order_acquire); }
+
+    /// <summary>
+    /// Akses entri tanpa memperpanjang; hanya sah untuk index &lt; size(), atau di dalam
+    /// fungsi langkah untuk index yang lebih kecil dari entri yang sedang dihitung.
+    /// </summary>
+    const T& entry(size_t index) const {
+        size_t chunk, offset;
+        locate(index, chunk, offset);
+        return m_chunks[chunk].load(std::memory_order_relaxed)[offset];
+    }
+
+    /// <summary>
+    /// Memastikan setidaknya <paramref name="count"/> entri tersedia.
+    /// </summary>
+    void extendTo(size_t count) {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        const size_t length = m_length.load(std::memory_order_relaxed);
+        if (count <= length) return;
+        const size_t minimumBulk = kFirstChunk;
+        const size_t target = std::max(count, std::max(2 * length, minimumBulk));
+        for (size_t i = length; i < target; ++i) {
+            size_t chunk, offset;
+            locate(i, chunk, offset);
+            T* storage = m_chunks[chunk].load(std::memory_order_relaxed);
+            if (storage == nullptr) {
+                storage = new T[kFirstChunk << chunk];
+                m_chunks[chunk].store(storage, std::memory_order_relaxed);
+            }
+            storage[offset] = m_step(i, *this);
+        }
+        m_length.store(target, std::memory_order_release);
+    }
+
+private:
+    static const size_t kFirstChunk = 64;
+
+    static void locate(size_t index, size_t& chunk, size_t& offset) {
+        const uint64_t scaled = index / kFirstChunk + 1;
+        chunk = 63 - countLeadingZeros64(scaled);
+        offset = index - kFirstChunk * ((static_cast<size_t>(1) << chunk) - 1);
+    }
+
+    Step m_step;
+    std::atomic<size_t> m_length;
+    std::atomic<T*> m_chunks[48];
+    std::mutex m_writerMutex;
+};
+
+/// <summary>Langkah memo untuk n! mod <paramref name="modulus"/>.</summary>
+ConcurrentMemoTable<uint64_t>::Step factorialModStep(uint64_t modulus) {
+    return [modulus](size_t index, const ConcurrentMemoTable<uint64_t>& table) -> uint64_t {
+        if (index == 0) return 1 % modulus;
+        return mulMod64(table.entry(index - 1), index % modulus, modulus);
+    };
+}
+
+/// <summary>Langkah memo untuk F(n) mod <paramref name="modulus"/>.</summary>
+ConcurrentMemoTable<uint64_t>::Step fibonacciModStep(uint64_t modulus) {
+    return [modulus](size_t index, const ConcurrentMemoTable<uint64_t>& table) -> uint64_t {
+        if (index < 2) return index % modulus;
+        uint64_t a = table.entry(index - 1), b = table.entry(index - 2);
+        return (a >= modulus - b) ? a - (modulus - b) : a + b;
+    };
+}
+
+/// <summary>Langkah memo untuk n! berpresisi sembarang.</summary>
+ConcurrentMemoTable<BigUnsigned>::Step factorialBigStep() {
+    return [](size_t index, const ConcurrentMemoTable<BigUnsigned>& table) {
+        if (index == 0) return BigUnsigned(1);
+        BigUnsigned value = table.entry(index - 1);
+        value.multiplySmallInPlace(static_cast<uint32_t>(index));
+        return value;
+    };
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="ConcurrentMemoTable"/> dengan banyak thread pembaca.
+/// </summary>
+void testConcurrentMemoTable() {
+    const uint64_t modulus = 1000000007;
+    const size_t limit = 100000;
+    std::vector<uint64_t> factorials(limit), fibonaccis(limit);
+    factorials[0] = 1;
+    fibonaccis[0] = 0;
+    fibonaccis[1] = 1;
+    for (size_t i = 1; i < limit; ++i) factorials[i] = factorials[i - 1] * i % modulus;
+    for (size_t i = 2; i < limit; ++i) fibonaccis[i] = (fibonaccis[i - 1] + fibonaccis[i - 2]) % modulus;
+
+    ConcurrentMemoTable<uint64_t> factorialTable(factorialModStep(modulus));
+    ConcurrentMemoTable<uint64_t> fibonacciTable(fibonacciModStep(modulus));
+    ConcurrentMemoTable<BigUnsigned> bigTable(factorialBigStep());
+    std::atomic<int> mismatches(0);
+    parallelFor(8, 8, [&](size_t thread) {
+        Xoshiro256StarStar rng(thread);
+        for (int q = 0; q < 5000; ++q) {
+            size_t i = static_cast<size_t>(rng() % limit);
+            if (factorialTable.get(i) != factorials[i]) ++mismatches;
+            if (fibonacciTable.get(i) != fibonaccis[i]) ++mismatches;
+        }
+        const BigUnsigned& big = bigTable.get(30 + thread);
+        if (big != factorialBig(static_cast<uint32_t>(30 + thread))) ++mismatches;
+    });
+    assert(mismatches == 0);
+    assert(factorialTable.size() >= limit / 2);
+
+    // Referensi tetap sah setelah tabel diperpanjang jauh.
+    const uint64_t& early = fibonacciTable.get(10);
+    fibonacciTable.get(limit * 3);
+    assert(early == 55);
+    assert(fibonacciTable.get(90) == 2880067194370816120ull % modulus);
+
+    std::cout << "Semua uji tabel memo konkuren lulus!\n";
+}
+
+/// <summary>
+/// 23) Cache hasil <see cref="isPrime64"/> yang di-shard, open addressing, dan bebas kunci.
+/// </summary>
+/// <remarks>
+/// Setiap slot adalah satu kata atomik 64-bit: bit 0..61 = kunci + 1 (0 berarti kosong),
+/// bit 62 = hasil primalitas, bit 63 = bit referensi CLOCK. Kunci di-hash dengan hashing
+/// Fibonacci; bit atas memilih shard, bit berikutnya memilih slot awal, lalu probing linear
+/// paling banyak <see cref="kMaxProbe"/> slot. Bila semua penuh, jarum CLOCK milik shard
+/// berputar: slot dengan bit referensi diberi kesempatan kedua, slot tanpa bit referensi
+/// diganti lewat CAS. Penyisipan bersifat best-effort: bila CAS kalah berulang kali, hasil
+/// tetap dikembalikan tanpa disimpan. Nilai &gt;= 2^62 - 1 melewati cache.
+/// </remarks>
+class PrimalityCache {
+public:
+    /// <summary>Jumlah slot yang diperiksa per pencarian.</summary>
+    static const size_t kMaxProbe = 8;
+
+    /// <summary>Membuat cache.</summary>
+    /// <param name="capacity">Total slot minimal; dibulatkan ke pangkat dua.</param>
+    /// <param name="shardCount">Jumlah shard minimal; dibulatkan ke pangkat dua.</param>
+    /// <exception cref="std::invalid_argument">Bila kapasitas per shard &lt; kMaxProbe.</exception>
+    PrimalityCache(size_t capacity, size_t shardCount = 64) {
+        m_shardBits = 0;
+        while ((static_cast<size_t>(1) << m_shardBits) < shardCount) ++m_shardBits;
+        m_slotBits = 0;
+        while ((static_cast<size_t>(1) << (m_shardBits + m_slotBits)) < capacity) ++m_slotBits;
+        if ((static_cast<size_t>(1) << m_slotBits) < kMaxProbe) {
+            throw std::invalid_argument("Kapasitas per shard terlalu kecil");
+        }
+        const size_t shards = static_cast<size_t>(1) << m_shardBits;
+        const size_t slots = static_cast<size_t>(1) << m_slotBits;
+        // new Shard[] baru menghormati alignas(64) sejak C++17, jadi penyelarasan dilakukan sendiri.
+        size_t space = shards * sizeof(Shard) + alignof(Shard);
+        m_shardStorage.reset(new unsigned char[space]);
+        void* aligned = m_shardStorage.get();
+        m_shards = static_cast<Shard*>(std::align(alignof(Shard), shards * sizeof(Shard), aligned, space));
+        for (size_t s = 0; s < shards; ++s) new (&m_shards[s]) Shard();
+        for (size_t s = 0; s < shards; ++s) {
+            m_shards[s].slots.reset(new std::atomic<uint64_t>[slots]);
+            for (size_t i = 0; i < slots; ++i) m_shards[s].slots[i].store(0, std::memory_order_relaxed);
+            m_shards[s].hand.store(0, std::memory_order_relaxed);
+            m_shards[s].hits.store(0, std::memory_order_relaxed);
+            m_shards[s].misses.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ~PrimalityCache() {
+        for (size_t s = 0; s < shardCount(); ++s) m_shards[s].~Shard();
+    }
+
+    PrimalityCache(const PrimalityCache&) = delete;
+    PrimalityCache& operator=(const PrimalityCache&) = delete;
+
+    /// <summary>
+    /// Uji primalitas lewat cache; aman dipanggil bersamaan dari banyak thread.
+    /// </summary>
+    bool isPrime(uint64_t n) {
+        if (n >= kKeyMask) {
+            m_shards[0].misses.fetch_add(1, std::memory_order_relaxed);
+            return isPrime64(n);
+        }
+        const uint64_t hash = n * 0x9E3779B97F4A7C15ull;
+        Shard& shard = m_shards[m_shardBits == 0 ? 0 : hash >> (64 - m_shardBits)];
+        const size_t mask = (static_cast<size_t>(1) << m_slotBits) - 1;
+        const size_t start = static_cast<size_t>((hash << m_shardBits) >> (64 - m_slotBits));
+        const uint64_t key = n + 1;
+
+        for (size_t probe = 0; probe < kMaxProbe; ++probe) {
+            std::atomic<uint64_t>& slot = shard.slots[(start + probe) & mask];
+            const uint64_t word = slot.load(std::memory_order_relaxed);
+            if ((word & kKeyMask) == key) {
+                if ((word & kReferenceBit) == 0) slot.fetch_or(kReferenceBit, std::memory_order_relaxed);
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                return (word & kResultBit) != 0;
+            }
+            if (word == 0) break;
+        }
+
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        const bool result = isPrime64(n);
+        const uint64_t entry = key | (result ? kResultBit : 0);
+        for (size_t probe = 0; probe < kMaxProbe; ++probe) {
+            uint64_t expected = 0;
+            if (shard.slots[(start + probe) & mask].compare_exchange_strong(expected, entry, std::memory_order_relaxed)) {
+                return result;
+            }
+            if ((expected & kKeyMask) == key) return result;
+        }
+        // Semua slot probe terisi: jarum CLOCK mencari korban di antara slot probe tersebut.
+        for (size_t step = 0; step < 2 * kMaxProbe; ++step) {
+            const size_t offset = shard.hand.fetch_add(1, std::memory_order_relaxed) % kMaxProbe;
+            std::atomic<uint64_t>& slot = shard.slots[(start + offset) & mask];
+            uint64_t word = slot.load(std::memory_order_relaxed);
+            if ((word & kReferenceBit) != 0) {
+                slot.compare_exchange_strong(word, word & ~kReferenceBit, std::memory_order_relaxed);
+            }
+            else if (slot.compare_exchange_strong(word, entry, std::memory_order_relaxed)) {
+                return result;
+            }
+        }
+        return result;
+    }
+
+    /// <summary>Jumlah kueri yang dijawab dari cache.</summary>
+    uint64_t hits() const { return sumCounter(&Shard::hits); }
+
+    /// <summary>Jumlah kueri yang harus dihitung (termasuk yang melewati cache).</summary>
+    uint64_t misses() const { return sumCounter(&Shard::misses); }
+
+    /// <summary>Total slot.</summary>
+    size_t capacity() const { return static_cast<size_t>(1) << (m_shardBits + m_slotBits); }
+
+    /// <summary>Jumlah shard.</summary>
+    size_t shardCount() const { return static_cast<size_t>(1) << m_shardBits; }
+
+private:
+    static const uint64_t kKeyMask = (1ull << 62) - 1;
+    static const uint64_t kResultBit = 1ull << 62;
+    static const uint64_t kReferenceBit = 1ull << 63;
+
+    // Setiap shard dimulai di baris cache sendiri dan penghitungnya diberi padding selebar
+    // baris cache agar tidak terjadi false sharing.
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> hits;
+        char hitsPadding[56];
+        std::atomic<uint64_t> misses;
+        char missesPadding[56];
+        std::atomic<size_t> hand;
+        char handPadding[56];
+        std::unique_ptr<std::atomic<uint64_t>[]> slots;
+    };
+
+    uint64_t sumCounter(std::atomic<uint64_t> Shard::*counter) const {
+        uint64_t total = 0;
+        for (size_t s = 0; s < shardCount(); ++s) total += (m_shards[s].*counter).load(std::memory_order_relaxed);
+        return total;
+    }
+
+    unsigned m_shardBits;
+    unsigned m_slotBits;
+    std::unique_ptr<unsigned char[]> m_shardStorage;
+    Shard* m_shards;
+};
+
+/// <summary>
+/// Hasil pengukuran throughput <see cref="PrimalityCache"/>.
+/// </summary>
+struct CacheThroughput {
+    double seconds;
+    double queriesPerSecond;
+    double hitRate;
+};
+
+/// <summary>
+/// Mengukur throughput cache dengan <paramref name="threadCount"/> thread yang bersaing,
+/// masing-masing menjalankan seluruh <paramref name="queries"/> dari offset berbeda.
+/// </summary>
+/// <param name="cache">Cache yang diukur; penghitungnya ikut bertambah.</param>
+/// <param name="queries">Barisan kueri (misalnya berdistribusi miring).</param>
+/// <param name="threadCount">Jumlah thread, misalnya 64.</param>
+/// <returns>Durasi, kueri per detik, dan rasio hit selama pengukuran.</returns>
+CacheThroughput measurePrimalityCacheThroughput(PrimalityCache& cache, const std::vector<uint64_t>& queries,
+    unsigned threadCount) {
+    const uint64_t hitsBefore = cache.hits(), missesBefore = cache.misses();
+    std::atomic<size_t> primes(0);
+    const auto begin = std::chrono::steady_clock::now();
+    parallelFor(threadCount, threadCount, [&](size_t thread) {
+        size_t local = 0;
+        const size_t offset = queries.empty() ? 0 : thread * 7919 % queries.size();
+        for (size_t i = 0; i < queries.size(); ++i) {
+            size_t index = offset + i;
+            if (index >= queries.size()) index -= queries.size();
+            local += cache.isPrime(queries[index]) ? 1 : 0;
+        }
+        primes += local;
+    });
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    const double hits = static_cast<double>(cache.hits() - hitsBefore);
+    const double total = hits + static_cast<double>(cache.misses() - missesBefore);
+    CacheThroughput result;
+    result.seconds = seconds;
+    result.queriesPerSecond = seconds > 0 ? total / seconds : 0;
+    result.hitRate = total > 0 ? hits / total : 0;
+    return result;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="PrimalityCache"/>.
+/// </summary>
+void testPrimalityCache() {
+    // Beban miring: indeks kecil jauh lebih sering muncul.
+    Xoshiro256StarStar rng(2024);
+    std::vector<uint64_t> distinct(4096);
+    for (uint64_t& value : distinct) value = (rng() >> 3) | 1;
+    std::vector<uint64_t> queries(20000);
+    for (uint64_t& query : queries) {
+        const uint64_t r = rng() % distinct.size();
+        query = distinct[r * r / distinct.size()];
+    }
+
+    PrimalityCache cache(1024, 16);
+    assert(cache.capacity() == 1024 && cache.shardCount() == 16);
+    for (uint64_t query : queries) assert(cache.isPrime(query) == isPrime64(query));
+    assert(cache.hits() + cache.misses() == queries.size());
+    assert(cache.hits() > queries.size() / 3);
+
+    // Nilai besar melewati cache namun tetap benar.
+    assert(cache.isPrime(kLargestPrime64));
+    assert(!cache.isPrime(kLargestPrime64 - 2));
+
+    std::atomic<int> mismatches(0);
+    parallelFor(64, 64, [&](size_t thread) {
+        for (size_t i = thread; i < queries.size(); i += 16) {
+            if (cache.isPrime(queries[i]) != isPrime64(queries[i])) ++mismatches;
+        }
+    });
+    assert(mismatches == 0);
+
+    PrimalityCache contended(1 << 14);
+    const CacheThroughput throughput = measurePrimalityCacheThroughput(contended, queries, 64);
+    assert(contended.hits() + contended.misses() == 64 * queries.size());
+    assert(throughput.hitRate > 0.9);
+    std::cout << "Throughput 64 thread: " << static_cast<uint64_t>(throughput.queriesPerSecond)
+        << " kueri/detik, rasio hit " << throughput.hitRate << "\n";
+
+    try {
+        PrimalityCache tooSmall(64, 64);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji cache primalitas lulus!\n";
+}
+
+/// <summary>
+/// Menulis satu kata 64-bit little-endian; format berkas tabel kombinatorika tersusun dari
+/// kata-kata ini agar portabel.
+/// </summary>
+inline void writeTableWord(std::ostream& out, uint64_t value) {
+    char bytes[8];
+    for (int i = 0; i < 8; ++i) bytes[i] = static_cast<char>(value >> (8 * i));
+    out.write(bytes, 8);
+}
+
+inline bool readTableWord(std::istream& in, uint64_t& value) {
+    unsigned char bytes[8];
+    if (!in.read(reinterpret_cast<char*>(bytes), 8)) return false;
+    value = 0;
+    for (int i = 0; i < 8; ++i) value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+    return true;
+}
+
+inline uint64_t tableValueKind(const uint64_t*) { return 0; }
+inline uint64_t tableValueKind(const BigUnsigned*) { return 1; }
+
+inline void writeTableValue(std::ostream& out, uint64_t value) { writeTableWord(out, value); }
+
+inline bool readTableValue(std::istream& in, uint64_t& value) { return readTableWord(in, value); }
+
+inline void writeTableValue(std::ostream& out, const BigUnsigned& value) {
+    const std::vector<uint32_t>& limbs = value.limbs();
+    writeTableWord(out, limbs.size());
+    for (size_t i = 0; i < limbs.size(); i += 2) {
+        writeTableWord(out, limbs[i] | (i + 1 < limbs.size() ? static_cast<uint64_t>(limbs[i + 1]) << 32 : 0));
+    }
+}
+
+inline bool readTableValue(std::istream& in, BigUnsigned& value) {
+    uint64_t count = 0;
+    if (!readTableWord(in, count) || count > (1u << 26)) return false;
+    std::vector<uint32_t> limbs(static_cast<size_t>(count));
+    for (size_t i = 0; i < limbs.size(); i += 2) {
+        uint64_t word;
+        if (!readTableWord(in, word)) return false;
+        limbs[i] = static_cast<uint32_t>(word);
+        if (i + 1 < limbs.size()) limbs[i + 1] = static_cast<uint32_t>(word >> 32);
+    }
+    value = BigUnsigned::fromLimbs(std::move(limbs));
+    return true;
+}
+
+/// <summary>
+/// 24) Tabel segitiga terpadat untuk kombinatorika: baris r memuat kolom 0..r, disimpan
+/// baris demi baris dalam satu vektor kontigu (offset baris r = r(r+1)/2).
+/// </summary>
+/// <typeparam name="T">Tipe nilai (<c>uint64_t</c> untuk mod p, <see cref="BigUnsigned"/> untuk eksak).</typeparam>
+template <typename T>
+class TriangularTable {
+public:
+    TriangularTable() : m_rows(0) {}
+
+    /// <summary>Membuat tabel dengan baris 0..rows-1 berisi nilai default.</summary>
+    explicit TriangularTable(size_t rows) : m_rows(rows), m_values(rows * (rows + 1) / 2) {}
+
+    size_t rows() const { return m_rows; }
+
+    const T& at(size_t row, size_t column) const {
+        assert(row < m_rows && column <= row);
+        return m_values[row * (row + 1) / 2 + column];
+    }
+
+    T& at(size_t row, size_t column) {
+        assert(row < m_rows && column <= row);
+        return m_values[row * (row + 1) / 2 + column];
+    }
+
+    /// <summary>Penunjuk ke awal baris (row + 1 nilai berurutan).</summary>
+    const T* row(size_t row) const { return m_values.data() + row * (row + 1) / 2; }
+
+    /// <summary>
+    /// Menulis tabel ke stream biner: magic, versi, jenis nilai, jumlah baris, lalu nilai
+    /// baris demi baris. Semua bilangan ditulis little-endian sehingga berkas portabel.
+    /// </summary>
+    void write(std::ostream& out) const {
+        writeTableWord(out, kMagic);
+        writeTableWord(out, kVersion);
+        writeTableWord(out, tableValueKind(static_cast<const T*>(nullptr)));
+        writeTableWord(out, m_rows);
+        for (const T& value : m_values) writeTableValue(out, value);
+        if (!out) {
+            throw std::runtime_error("Gagal menulis tabel");
+        }
+    }
+
+    /// <summary>Membaca tabel yang ditulis oleh <see cref="write"/>.</summary>
+    /// <exception cref="std::invalid_argument">Bila header tidak cocok atau stream terpotong.</exception>
+    /// <remarks>
+    /// Setiap sel menempati paling sedikit satu kata, jadi jumlah baris dicocokkan dengan sisa
+    /// stream (bila stream dapat di-seek) sebelum apa pun dialokasikan; untuk stream lain
+    /// vektor tumbuh mengikuti data yang benar-benar terbaca.
+    /// </remarks>
+    static TriangularTable read(std::istream& in) {
+        uint64_t magic = 0, version = 0, kind = 0, rows = 0;
+        if (!readTableWord(in, magic) || !readTableWord(in, version) || !readTableWord(in, kind) ||
+            !readTableWord(in, rows) || magic != kMagic || version != kVersion ||
+            kind != tableValueKind(static_cast<const T*>(nullptr)) || rows > (1u << 24)) {
+            throw std::invalid_argument("Header tabel tidak valid");
+        }
+        const uint64_t cells = rows * (rows + 1) / 2;
+        const std::istream::pos_type position = in.tellg();
+        if (position != std::istream::pos_type(-1)) {
+            in.seekg(0, std::ios::end);
+            const uint64_t remaining = static_cast<uint64_t>(in.tellg() - position);
+            in.seekg(position);
+            if (remaining / 8 < cells) {
+                throw std::invalid_argument("Data tabel terpotong");
+            }
+        }
+        TriangularTable table;
+        table.m_values.reserve(static_cast<size_t>(std::min<uint64_t>(cells, 1u << 16)));
+        for (uint64_t i = 0; i < cells; ++i) {
+            T value;
+            if (!readTableValue(in, value)) {
+                throw std::invalid_argument("Data tabel terpotong");
+            }
+            table.m_values.push_back(std::move(value));
+        }
+        table.m_rows = static_cast<size_t>(rows);
+        return table;
+    }
+
+private:
+    static const uint64_t kMagic = 0x4C42415454525049ull; // "IPRTTABL"
+    static const uint64_t kVersion = 1;
+
+    size_t m_rows;
+    std::vector<T> m_values;
+};
+
+/// <summary>
+/// Kebijakan aritmetika mod p untuk generator tabel kombinatorika.
+/// </summary>
+/// <remarks>
+/// Perkalian memakai <see cref="BarrettContext64"/> untuk modulus &lt; 2^62; Barrett dipilih
+/// karena, berbeda dengan Montgomery, modulus genap pun boleh dan nilai tidak perlu diubah
+/// bentuknya saat masuk dan keluar tabel. Modulus yang lebih besar jatuh ke <see cref="mulMod64"/>.
+/// </remarks>
+struct ModularCombinatorics {
+    using Value = uint64_t;
+
+    /// <exception cref="std::invalid_argument">Bila modulus &lt; 2.</exception>
+    explicit ModularCombinatorics(uint64_t value)
+        : m_modulus(value), m_barrett(value >= 2 && value < (1ull << 62) ? value : 2) {
+        if (value < 2) {
+            throw std::invalid_argument("Modulus harus >= 2");
+        }
+    }
+
+    uint64_t modulus() const { return m_modulus; }
+
+    Value zero() const { return 0; }
+    Value one() const { return 1; }
+    Value add(Value a, const Value& b) const { return (a >= m_modulus - b) ? a - (m_modulus - b) : a + b; }
+    Value multiply(const Value& a, const Value& b) const {
+        return m_modulus < (1ull << 62) ? m_barrett.multiply(a, b) : mulMod64(a, b, m_modulus);
+    }
+    Value multiplySmall(const Value& a, uint64_t factor) const { return multiply(a, factor % m_modulus); }
+
+private:
+    uint64_t m_modulus;
+    BarrettContext64 m_barrett;
+};
+
+/// <summary>
+/// Kebijakan aritmetika eksak (<see cref="BigUnsigned"/>) untuk generator tabel kombinatorika.
+/// </summary>
+struct BigCombinatorics {
+    using Value = BigUnsigned;
+
+    Value zero() const { return BigUnsigned(); }
+    Value one() const { return BigUnsigned(1); }
+    Value add(Value a, const Value& b) const { return a += b; }
+    Value multiply(const Value& a, const Value& b) const { return a * b; }
+    Value multiplySmall(Value a, uint64_t factor) const {
+        if (factor <= UINT32_MAX) {
+            a.multiplySmallInPlace(static_cast<uint32_t>(factor));
+            return a;
+        }
+        return a * BigUnsigned(factor);
+    }
+};
+
+/// <summary>Ukuran ubin default untuk pengisian wavefront.</summary>
+const size_t kDefaultWavefrontTile = 64;
+
+/// <summary>
+/// Mengisi segitiga baris 0..rows-1 dengan paralelisme wavefront anti-diagonal.
+/// </summary>
+/// <param name="rows">Jumlah baris.</param>
+/// <param name="tileSize">Sisi ubin persegi.</param>
+/// <param name="threadCount">Jumlah thread; 0 berarti semua core.</param>
+/// <param name="cell">cell(i, j) menghitung sel (i, j) dan boleh membaca (i-1, j-1), (i-1, j), (i, j-1).</param>
+/// <remarks>
+/// Ubin (r, c) hanya bergantung pada ubin (r-1, c-1), (r-1, c), dan (r, c-1), yang semuanya
+/// terletak pada anti-diagonal sebelumnya; jadi ubin pada anti-diagonal yang sama dihitung
+/// bersamaan dan setiap anti-diagonal adalah satu penghalang.
+/// </remarks>
+template <typename Cell>
+void fillTriangleWavefront(size_t rows, size_t tileSize, unsigned threadCount, Cell&& cell) {
+    if (rows == 0) return;
+    if (tileSize == 0) {
+        throw std::invalid_argument("Ukuran ubin harus positif");
+    }
+    const size_t tiles = (rows + tileSize - 1) / tileSize;
+    std::vector<std::pair<size_t, size_t>> diagonal;
+    for (size_t d = 0; d <= 2 * (tiles - 1); ++d) {
+        diagonal.clear();
+        for (size_t tileRow = (d + 1) / 2; tileRow <= std::min(d, tiles - 1); ++tileRow) {
+            diagonal.emplace_back(tileRow, d - tileRow);
+        }
+        parallelFor(diagonal.size(), threadCount, [&](size_t t) {
+            const size_t rowBegin = diagonal[t].first * tileSize;
+            const size_t rowEnd = std::min(rows, rowBegin + tileSize);
+            const size_t columnBegin = diagonal[t].second * tileSize;
+            for (size_t i = rowBegin; i < rowEnd; ++i) {
+                const size_t columnEnd = std::min(i + 1, columnBegin + tileSize);
+                for (size_t j = columnBegin; j < columnEnd; ++j) cell(i, j);
+            }
+        });
+    }
+}
+
+/// <summary>Tabel binomial C(n, k) untuk n &lt; rows (segitiga Pascal).</summary>
+template <typename Arithmetic>
+TriangularTable<typename Arithmetic::Value> binomialTable(size_t rows, const Arithmetic& arithmetic,
+    unsigned threadCount = 0, size_t tileSize = kDefaultWavefrontTile) {
+    TriangularTable<typename Arithmetic::Value> table(rows);
+    fillTriangleWavefront(rows, tileSize, threadCount, [&](size_t i, size_t j) {
+        table.at(i, j) = (j == 0 || j == i) ? arithmetic.one() : arithmetic.add(table.at(i - 1, j - 1), table.at(i - 1, j));
+    });
+    return table;
+}
+
+/// <summary>Tabel Stirling jenis pertama tak bertanda c(n, k): c(n, k) = (n-1)c(n-1, k) + c(n-1, k-1).</summary>
+template <typename Arithmetic>
+TriangularTable<typename Arithmetic::Value> stirlingFirstTable(size_t rows, const Arithmetic& arithmetic,
+    unsigned threadCount = 0, size_t tileSize = kDefaultWavefrontTile) {
+    TriangularTable<typename Arithmetic::Value> table(rows);
+    fillTriangleWavefront(rows, tileSize, threadCount, [&](size_t i, size_t j) {
+        if (j == i) table.at(i, j) = arithmetic.one();
+        else if (j == 0) table.at(i, j) = arithmetic.zero();
+        else table.at(i, j) = arithmetic.add(arithmetic.multiplySmall(table.at(i - 1, j), i - 1), table.at(i - 1, j - 1));
+    });
+    return table;
+}
+
+/// <summary>Tabel Stirling jenis kedua S(n, k): S(n, k) = k S(n-1, k) + S(n-1, k-1).</summary>
+template <typename Arithmetic>
+TriangularTable<typename Arithmetic::Value> stirlingSecondTable(size_t rows, const Arithmetic& arithmetic,
+    unsigned threadCount = 0, size_t tileSize = kDefaultWavefrontTile) {
+    TriangularTable<typename Arithmetic::Value> table(rows);
+    fillTriangleWavefront(rows, tileSize, threadCount, [&](size_t i, size_t j) {
+        if (j == i) table.at(i, j) = arithmetic.one();
+        else if (j == 0) table.at(i, j) = arithmetic.zero();
+        else table.at(i, j) = arithmetic.add(arithmetic.multiplySmall(table.at(i - 1, j), j), table.at(i - 1, j - 1));
+    });
+    return table;
+}
+
+/// <summary>
+/// Bilangan Catalan C_0..C_{count-1} sebagai diagonal segitiga Catalan
+/// T(n, k) = T(n, k-1) + T(n-1, k), dengan T(n, n) = C_n.
+/// </summary>
+template <typename Arithmetic>
+std::vector<typename Arithmetic::Value> catalanNumbers(size_t count, const Arithmetic& arithmetic,
+    unsigned threadCount = 0, size_t tileSize = kDefaultWavefrontTile) {
+    TriangularTable<typename Arithmetic::Value> table(count);
+    fillTriangleWavefront(count, tileSize, threadCount, [&](size_t i, size_t j) {
+        if (j == 0) table.at(i, j) = arithmetic.one();
+        else if (j == i) table.at(i, j) = table.at(i, j - 1);
+        else table.at(i, j) = arithmetic.add(table.at(i, j - 1), table.at(i - 1, j));
+    });
+    std::vector<typename Arithmetic::Value> result(count);
+    for (size_t n = 0; n < count; ++n) result[n] = table.at(n, n);
+    return result;
+}
+
+/// <summary>
+/// Bilangan Bell B_0..B_{count-1}: tabel Stirling kedua lalu jumlah tiap baris
+/// yang dihitung paralel per baris.
+/// </summary>
+template <typename Arithmetic>
+std::vector<typename Arithmetic::Value> bellNumbers(size_t count, const Arithmetic& arithmetic,
+    unsigned threadCount = 0, size_t tileSize = kDefaultWavefrontTile) {
+    const TriangularTable<typename Arithmetic::Value> stirling = stirlingSecondTable(count, arithmetic, threadCount, tileSize);
+    std::vector<typename Arithmetic::Value> result(count);
+    parallelFor(count, threadCount, [&](size_t n) {
+        typename Arithmetic::Value sum = arithmetic.zero();
+        const typename Arithmetic::Value* row = stirling.row(n);
+        for (size_t k = 0; k <= n; ++k) sum = arithmetic.add(std::move(sum), row[k]);
+        result[n] = std::move(sum);
+    });
+    return result;
+}
+
+/// <summary>
+/// Koefisien multinomial (k1 + ... + km)! / (k1! ... km!) sebagai hasil kali binomial
+/// C(k1 + ... + ki, ki) yang dibaca dari tabel binomial.
+/// </summary>
+/// <exception cref="std::invalid_argument">Bila jumlah bagian tidak tercakup tabel.</exception>
+template <typename Arithmetic>
+typename Arithmetic::Value multinomial(const TriangularTable<typename Arithmetic::Value>& binomials,
+    const std::vector<size_t>& parts, const Arithmetic& arithmetic) {
+    typename Arithmetic::Value result = arithmetic.one();
+    size_t total = 0;
+    for (size_t part : parts) {
+        total += part;
+        if (total >= binomials.rows()) {
+            throw std::invalid_argument("Tabel binomial terlalu kecil untuk multinomial");
+        }
+        result = arithmetic.multiply(result, binomials.at(total, part));
+    }
+    return result;
+}
+
+/// <summary>
+/// Kumpulan uji untuk generator tabel kombinatorika.
+/// </summary>
+void testCombinatoricsTables() {
+    const BigCombinatorics big;
+    const ModularCombinatorics mod(1000000007);
+
+    const TriangularTable<BigUnsigned> bigBinomials = binomialTable(101, big, 4, 7);
+    assert(bigBinomials.at(100, 50).toString() == "100891344545564193334812497256");
+    assert(multinomial(bigBinomials, { 2, 3, 4 }, big) == BigUnsigned(1260));
+
+    // Hasil paralel identik dengan hasil satu thread untuk berbagai ukuran ubin.
+    const TriangularTable<uint64_t> serial = binomialTable(300, mod, 1, 300);
+    for (size_t tile : { 1, 7, 64 }) {
+        const TriangularTable<uint64_t> parallel = binomialTable(300, mod, 8, tile);
+        for (size_t i = 0; i < 300; ++i) {
+            for (size_t j = 0; j <= i; ++j) assert(parallel.at(i, j) == serial.at(i, j));
+        }
+    }
+    for (size_t i = 0; i <= 100; ++i) {
+        for (size_t j = 0; j <= i; ++j) assert(bigBinomials.at(i, j).modSmall(1000000007) == serial.at(i, j));
+    }
+
+    const TriangularTable<BigUnsigned> first = stirlingFirstTable(20, big, 3, 4);
+    const TriangularTable<BigUnsigned> second = stirlingSecondTable(20, big, 3, 4);
+    assert(first.at(10, 3) == BigUnsigned(1172700));
+    assert(second.at(10, 3) == BigUnsigned(9330));
+    for (size_t n = 1; n < 20; ++n) {
+        BigUnsigned sum;
+        for (size_t k = 0; k <= n; ++k) sum += first.at(n, k);
+        assert(sum == factorialBig(static_cast<uint32_t>(n)));
+    }
+
+    const uint64_t bell[] = { 1, 1, 2, 5, 15, 52, 203, 877, 4140, 21147, 115975 };
+    const std::vector<BigUnsigned> bells = bellNumbers(31, big, 4, 5);
+    for (size_t n = 0; n < 11; ++n) assert(bells[n] == BigUnsigned(bell[n]));
+    assert(bells[30].toString() == "846749014511809332450147");
+
+    const uint64_t catalan[] = { 1, 1, 2, 5, 14, 42, 132, 429, 1430, 4862 };
+    const std::vector<BigUnsigned> catalans = catalanNumbers(31, big, 4, 3);
+    for (size_t n = 0; n < 10; ++n) assert(catalans[n] == BigUnsigned(catalan[n]));
+    assert(catalans[30] == BigUnsigned(3814986502092304ull));
+    const std::vector<uint64_t> catalansMod = catalanNumbers(31, mod);
+    assert(catalansMod[30] == 3814986502092304ull % 1000000007);
+    // Modulus genap dan modulus di atas batas Barrett.
+    auto reduce = [](const BigUnsigned& value, uint64_t modulus) {
+        uint64_t remainder = 0;
+        const std::vector<uint32_t>& limbs = value.limbs();
+        for (size_t i = limbs.size(); i-- > 0;) {
+            const uint64_t shifted = mulMod64(remainder, (1ull << 32) % modulus, modulus), limb = limbs[i] % modulus;
+            remainder = (shifted >= modulus - limb) ? shifted - (modulus - limb) : shifted + limb;
+        }
+        return remainder;
+    };
+    const ModularCombinatorics even(1ull << 40), wide(kLargestPrime64);
+    const TriangularTable<uint64_t> evenBinomials = binomialTable(101, even), wideBinomials = binomialTable(101, wide);
+    for (size_t j = 0; j <= 100; ++j) {
+        assert(evenBinomials.at(100, j) == reduce(bigBinomials.at(100, j), 1ull << 40));
+        assert(wideBinomials.at(100, j) == reduce(bigBinomials.at(100, j), kLargestPrime64));
+    }
+
+    // Serialisasi pulang-pergi untuk kedua jenis nilai.
+    std::stringstream modStream, bigStream;
+    serial.write(modStream);
+    bigBinomials.write(bigStream);
+    const TriangularTable<uint64_t> modCopy = TriangularTable<uint64_t>::read(modStream);
+    const TriangularTable<BigUnsigned> bigCopy = TriangularTable<BigUnsigned>::read(bigStream);
+    assert(modCopy.rows() == 300 && modCopy.at(299, 150) == serial.at(299, 150));
+    assert(bigCopy.rows() == 101 && bigCopy.at(100, 50) == bigBinomials.at(100, 50));
+
+    try {
+        std::stringstream wrongKind;
+        serial.write(wrongKind);
+        TriangularTable<BigUnsigned>::read(wrongKind);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    try {
+        std::stringstream full;
+        serial.write(full);
+        std::stringstream cut(full.str().substr(0, 200));
+        TriangularTable<uint64_t>::read(cut);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    try {
+        // Header mengklaim 2^24 baris tetapi tidak ada data: ditolak sebelum alokasi.
+        std::stringstream huge;
+        TriangularTable<uint64_t>(2).write(huge);
+        std::string bytes = huge.str().substr(0, 32);
+        bytes[24] = 0;
+        bytes[27] = 1;
+        std::stringstream header(bytes);
+        TriangularTable<uint64_t>::read(header);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    try {
+        multinomial(bigBinomials, { 60, 60 }, big);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji tabel kombinatorika lulus!\n";
+}
+
+/// <summary>
+/// 25) Eksponen prima p dalam n! menurut rumus Legendre: jumlah floor(n / p^k), k &gt;= 1.
+/// </summary>
+/// <param name="n">Argumen faktorial.</param>
+/// <param name="p">Bilangan prima (tidak diperiksa; untuk p komposit hasilnya tidak bermakna).</param>
+/// <returns>Valuasi p-adik dari n!; O(log_p n) pembagian.</returns>
+/// <exception cref="std::invalid_argument">Bila p &lt; 2.</exception>
+uint64_t factorialPrimeExponent(uint64_t n, uint64_t p) {
+    if (p < 2) {
+        throw std::invalid_argument("p harus prima");
+    }
+    uint64_t total = 0;
+    for (n /= p; n != 0; n /= p) total += n;
+    return total;
+}
+
+/// <summary>
+/// Jumlah nol di belakang n! dalam basis 10, yaitu eksponen 5 dalam n!.
+/// </summary>
+inline uint64_t factorialTrailingZeros(uint64_t n) {
+    uint64_t total = 0;
+    for (n /= 5; n != 0; n /= 5) total += n;
+    return total;
+}
+
+/// <summary>Argumen terbesar yang diterima <see cref="factorialDigitCount"/>.</summary>
+const uint64_t kMaxFactorialDigitArgument = 1ull << 40;
+
+/// <summary>
+/// Jumlah digit desimal n! = floor(log10 n!) + 1 lewat deret Stirling:
+/// log10 n! = n log10(n / e) + log10(2 pi n) / 2 + log10(e) / (12 n) - ...
+/// </summary>
+/// <param name="n">Argumen faktorial, paling besar <see cref="kMaxFactorialDigitArgument"/>.</param>
+/// <returns>Jumlah digit; O(1) tanpa menghitung n!.</returns>
+/// <exception cref="std::invalid_argument">Bila n &gt; 2^40.</exception>
+/// <remarks>
+/// n log10 n dipisah menjadi n k + n log10(n / 10^k) dengan k = floor(log10 n); bagian n k
+/// dihitung eksak sebagai bilangan bulat sehingga floating-point hanya membawa bagian pecahan.
+/// Untuk n &lt;= 2^40 galat mutlaknya sekitar 10^-3 dengan double (jauh lebih kecil dengan long
+/// double 80-bit), jadi hasil hanya dapat meleset satu digit bila log10 n! berjarak kurang dari
+/// itu ke bilangan bulat. Di atas 2^40 presisi double tidak lagi cukup, sehingga ditolak.
+/// </remarks>
+inline uint64_t factorialDigitCount(uint64_t n) {
+    if (n > kMaxFactorialDigitArgument) {
+        throw std::invalid_argument("n terlalu besar untuk jumlah digit faktorial");
+    }
+    if (n < 2) return 1;
+    uint64_t power = 1, k = 0;
+    while (power <= n / 10) {
+        power *= 10;
+        ++k;
+    }
+    const long double x = static_cast<long double>(n);
+    const long double kLog10E = 0.434294481903251827651128918916605082L;
+    const long double kLog10TwoPi = 0.798179868358115049580227656440346L;
+    const long double fraction = x * (std::log10(x / static_cast<long double>(power)) - kLog10E) +
+        (kLog10TwoPi + std::log10(x)) / 2 + kLog10E / (12 * x);
+    return static_cast<uint64_t>(static_cast<int64_t>(n * k) + static_cast<int64_t>(std::floor(fraction))) + 1;
+}
+
+/// <summary>
+/// Digit bukan nol terakhir dari n! dalam basis 10.
+/// </summary>
+/// <remarks>
+/// Memakai D(n) = 2^floor(n/5) * D(floor(n/5)) * D(n mod 5) (mod 10) dengan D(0..4) = 1, 1, 2, 6, 4.
+/// Pangkat dua mod 10 berperiode 4 untuk eksponen positif (6, 2, 4, 8 menurut eksponen mod 4)
+/// dan bernilai 1 untuk eksponen nol; jadi O(log_5 n) langkah.
+/// </remarks>
+inline unsigned factorialLastNonzeroDigit(uint64_t n) {
+    static const unsigned kSmall[5] = { 1, 1, 2, 6, 4 };
+    static const unsigned kPowerOfTwo[4] = { 6, 2, 4, 8 };
+    unsigned digit = 1;
+    while (n != 0) {
+        const uint64_t quotient = n / 5;
+        digit = digit * kSmall[n % 5] % 10;
+        if (quotient != 0) digit = digit * kPowerOfTwo[quotient % 4] % 10;
+        n = quotient;
+    }
+    return digit;
+}
+
+/// <summary>
+/// Nol di belakang n! untuk banyak n &lt; 2^32 sekaligus.
+/// </summary>
+/// <remarks>
+/// Jumlah iterasi tetap (5^14 &gt; 2^32) dan tanpa percabangan sehingga loop luar dapat
+/// divektorisasi; pembagian dengan konstanta menjadi perkalian-tinggi.
+/// </remarks>
+void factorialTrailingZerosBatch(const uint32_t* values, size_t count, uint32_t* results) {
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t quotient = values[i], total = 0;
+        for (int k = 0; k < 13; ++k) {
+            quotient /= 5;
+            total += quotient;
+        }
+        results[i] = total;
+    }
+}
+
+/// <summary>Nol di belakang n! untuk banyak n 64-bit sekaligus.</summary>
+void factorialTrailingZerosBatch(const uint64_t* values, size_t count, uint64_t* results) {
+    for (size_t i = 0; i < count; ++i) results[i] = factorialTrailingZeros(values[i]);
+}
+
+/// <summary>Eksponen prima p dalam n! untuk banyak n sekaligus.</summary>
+/// <exception cref="std::invalid_argument">Bila p &lt; 2.</exception>
+void factorialPrimeExponentBatch(const uint64_t* values, size_t count, uint64_t p, uint64_t* results) {
+    if (p < 2) {
+        throw std::invalid_argument("p harus prima");
+    }
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t total = 0;
+        for (uint64_t n = values[i] / p; n != 0; n /= p) total += n;
+        results[i] = total;
+    }
+}
+
+/// <summary>Jumlah digit n! untuk banyak n sekaligus.</summary>
+/// <exception cref="std::invalid_argument">Bila ada n &gt; 2^40.</exception>
+void factorialDigitCountBatch(const uint64_t* values, size_t count, uint64_t* results) {
+    for (size_t i = 0; i < count; ++i) results[i] = factorialDigitCount(values[i]);
+}
+
+/// <summary>Digit bukan nol terakhir n! untuk banyak n sekaligus.</summary>
+void factorialLastNonzeroDigitBatch(const uint64_t* values, size_t count, uint8_t* results) {
+    for (size_t i = 0; i < count; ++i) results[i] = static_cast<uint8_t>(factorialLastNonzeroDigit(values[i]));
+}
+
+/// <summary>
+/// Kumpulan uji untuk metadata faktorial.
+/// </summary>
+void testFactorialMetadata() {
+    // Bandingkan dengan n! eksak.
+    BigUnsigned value(1);
+    for (uint32_t n = 0; n <= 400; ++n) {
+        if (n > 0) value.multiplySmallInPlace(n);
+        const std::string digits = value.toString();
+        assert(factorialDigitCount(n) == digits.size());
+        const size_t lastNonzero = digits.find_last_not_of('0');
+        assert(factorialTrailingZeros(n) == digits.size() - 1 - lastNonzero);
+        assert(factorialLastNonzeroDigit(n) == static_cast<unsigned>(digits[lastNonzero] - '0'));
+
+        BigUnsigned rest = value;
+        uint64_t twos = 0;
+        while (!rest.isOdd()) {
+            rest.divideSmallInPlace(2);
+            ++twos;
+        }
+        uint64_t sevens = 0;
+        while (rest.modSmall(7) == 0) {
+            rest.divideSmallInPlace(7);
+            ++sevens;
+        }
+        assert(factorialPrimeExponent(n, 2) == twos);
+        assert(factorialPrimeExponent(n, 7) == sevens);
+    }
+
+    assert(factorialDigitCount(1000000) == 5565709);
+    assert(factorialDigitCount(1000000000) == 8565705523ull);
+    assert(factorialDigitCount(10000000000ull) == 95657055187ull);
+    assert(factorialDigitCount(1000000000000ull) == 11565705518104ull);
+    assert(factorialDigitCount(kMaxFactorialDigitArgument) == 12761927388952ull);
+    assert(factorialTrailingZeros(1000000000) == 249999998);
+    assert(factorialTrailingZeros(UINT64_MAX) == 4611686018427387890ull);
+    assert(factorialPrimeExponent(UINT64_MAX, UINT64_MAX) == 1);
+    assert(factorialLastNonzeroDigit(1000000) == 4);
+
+    Xoshiro256StarStar rng(65);
+    std::vector<uint32_t> small(1000);
+    std::vector<uint64_t> large(1000);
+    for (uint32_t& n : small) n = static_cast<uint32_t>(rng());
+    for (uint64_t& n : large) n = rng() >> (rng() % 64);
+    small[0] = UINT32_MAX;
+    std::vector<uint32_t> zerosSmall(small.size());
+    std::vector<uint64_t> zerosLarge(large.size()), exponents(large.size()), digitCounts(large.size());
+    std::vector<uint8_t> lastDigits(large.size());
+    factorialTrailingZerosBatch(small.data(), small.size(), zerosSmall.data());
+    factorialTrailingZerosBatch(large.data(), large.size(), zerosLarge.data());
+    factorialPrimeExponentBatch(large.data(), large.size(), 3, exponents.data());
+    std::vector<uint64_t> digitArguments(large.size());
+    for (size_t i = 0; i < large.size(); ++i) digitArguments[i] = large[i] % (kMaxFactorialDigitArgument + 1);
+    factorialDigitCountBatch(digitArguments.data(), digitArguments.size(), digitCounts.data());
+    factorialLastNonzeroDigitBatch(large.data(), large.size(), lastDigits.data());
+    for (size_t i = 0; i < small.size(); ++i) {
+        assert(zerosSmall[i] == factorialTrailingZeros(small[i]));
+        assert(zerosLarge[i] == factorialTrailingZeros(large[i]));
+        assert(exponents[i] == factorialPrimeExponent(large[i], 3));
+        assert(digitCounts[i] == factorialDigitCount(digitArguments[i]));
+        assert(lastDigits[i] == factorialLastNonzeroDigit(large[i]));
+    }
+
+    try {
+        factorialPrimeExponent(10, 1);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    try {
+        factorialDigitCount(kMaxFactorialDigitArgument + 1);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji metadata faktorial lulus!\n";
+}
+
+/// <summary>
+/// Tabel n! untuk 0 &lt;= n &lt;= 12, yaitu semua faktorial yang muat di <c>int</c> 32-bit.
+/// </summary>
+const int kFactorialInt[13] = { 1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880, 3628800, 39916800, 479001600 };
+
+/// <summary>
+/// F(n) untuk 0 &lt;= n &lt;= 46, yaitu semua bilangan Fibonacci yang muat di <c>int</c> 32-bit.
+/// </summary>
+const int kFibonacciInt[47] = {
+    0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89, 144, 233, 377, 610, 987, 1597, 2584, 4181, 6765,
+    10946, 17711, 28657, 46368, 75025, 121393, 196418, 317811, 514229, 832040, 1346269,
+    2178309, 3524578, 5702887, 9227465, 14930352, 24157817, 39088169, 63245986, 102334155,
+    165580141, 267914296, 433494437, 701408733, 1134903170, 1836311903 };
+
+/// <summary>
+/// 26) API kode status (tanpa exception): varian <see cref="factorial"/> untuk jalur batch.
+/// </summary>
+/// <param name="n">Bilangan bulat n.</param>
+/// <param name="result">Menerima n! bila berhasil; tidak diubah bila gagal.</param>
+/// <returns><see cref="Status::Failure"/> bila n &lt; 0 atau n! tidak muat di <c>int</c> (n &gt; 12).</returns>
+/// <remarks>
+/// Berbeda dengan <see cref="factorial"/>, overflow juga dilaporkan. Nilai dibaca dari tabel, O(1).
+/// </remarks>
+Status factorial(int n, int& result) noexcept {
+    if (static_cast<unsigned>(n) > 12u) return Status::Failure;
+    result = kFactorialInt[n];
+    return Status::Success;
+}
+
+/// <summary>
+/// Varian <see cref="fibonacci"/> tanpa exception untuk jalur batch.
+/// </summary>
+/// <param name="n">Indeks n.</param>
+/// <param name="result">Menerima F(n) bila berhasil; tidak diubah bila gagal.</param>
+/// <returns><see cref="Status::Failure"/> bila n &lt; 0 atau F(n) tidak muat di <c>int</c> (n &gt; 46).</returns>
+Status fibonacci(int n, int& result) noexcept {
+    if (static_cast<unsigned>(n) > 46u) return Status::Failure;
+    result = kFibonacciInt[n];
+    return Status::Success;
+}
+
+/// <summary>
+/// n! untuk banyak n sekaligus dengan mask galat per elemen.
+/// </summary>
+/// <param name="values">Masukan.</param>
+/// <param name="count">Jumlah elemen.</param>
+/// <param name="results">Menerima n!, atau 0 untuk elemen yang gagal.</param>
+/// <param name="errorMask">Menerima 1 untuk elemen yang gagal, 0 untuk yang berhasil.</param>
+/// <returns><see cref="Status::Success"/> bila semua elemen berhasil.</returns>
+/// <remarks>
+/// Loop tidak bercabang: indeks tidak sah dijepit ke 0 lalu hasilnya di-mask, sehingga masukan
+/// campuran sah/tidak sah berjalan dengan kecepatan yang sama dan loop dapat divektorisasi.
+/// </remarks>
+Status factorialBatch(const int* values, size_t count, int* results, uint8_t* errorMask) noexcept {
+    unsigned failures = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned n = static_cast<unsigned>(values[i]);
+        const unsigned invalid = n > 12u ? 1u : 0u;
+        results[i] = kFactorialInt[invalid ? 0u : n] & -static_cast<int>(invalid ^ 1u);
+        errorMask[i] = static_cast<uint8_t>(invalid);
+        failures |= invalid;
+    }
+    return failures ? Status::Failure : Status::Success;
+}
+
+/// <summary>
+/// F(n) untuk banyak n sekaligus dengan mask galat per elemen; lihat <see cref="factorialBatch"/>.
+/// </summary>
+Status fibonacciBatch(const int* values, size_t count, int* results, uint8_t* errorMask) noexcept {
+    unsigned failures = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned n = static_cast<unsigned>(values[i]);
+        const unsigned invalid = n > 46u ? 1u : 0u;
+        results[i] = kFibonacciInt[invalid ? 0u : n] & -static_cast<int>(invalid ^ 1u);
+        errorMask[i] = static_cast<uint8_t>(invalid);
+        failures |= invalid;
+    }
+    return failures ? Status::Failure : Status::Success;
+}
+
+/// <summary>
+/// Kumpulan uji untuk API kode status <see cref="factorial"/> dan <see cref="fibonacci"/>.
+/// </summary>
+void testStatusApi() {
+    for (int n = 0; n <= 12; ++n) {
+        int result = -1;
+        assert(factorial(n, result) == Status::Success);
+        assert(result == factorial(n));
+    }
+    for (int n = 0; n <= 46; ++n) {
+        int result = -1;
+        assert(fibonacci(n, result) == Status::Success);
+        assert(result == fibonacci(n));
+    }
+
+    int untouched = 7;
+    assert(factorial(-1, untouched) == Status::Failure && untouched == 7);
+    assert(factorial(13, untouched) == Status::Failure && untouched == 7);
+    assert(fibonacci(-5, untouched) == Status::Failure && untouched == 7);
+    assert(fibonacci(47, untouched) == Status::Failure && untouched == 7);
+    assert(fibonacci(INT32_MIN, untouched) == Status::Failure);
+
+    const std::vector<int> inputs = { 0, 5, -1, 12, 13, 46, 47, INT32_MIN, INT32_MAX, 3 };
+    std::vector<int> results(inputs.size());
+    std::vector<uint8_t> mask(inputs.size());
+    assert(factorialBatch(inputs.data(), inputs.size(), results.data(), mask.data()) == Status::Failure);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        int expected = 0;
+        const bool ok = factorial(inputs[i], expected) == Status::Success;
+        assert(mask[i] == (ok ? 0 : 1));
+        assert(results[i] == (ok ? expected : 0));
+    }
+    assert(fibonacciBatch(inputs.data(), inputs.size(), results.data(), mask.data()) == Status::Failure);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        int expected = 0;
+        const bool ok = fibonacci(inputs[i], expected) == Status::Success;
+        assert(mask[i] == (ok ? 0 : 1));
+        assert(results[i] == (ok ? expected : 0));
+    }
+
+    const std::vector<int> valid = { 0, 1, 10, 46 };
+    assert(fibonacciBatch(valid.data(), valid.size(), results.data(), mask.data()) == Status::Success);
+    assert(results[3] == 1836311903 && mask[3] == 0);
+
+    std::cout << "Semua uji API kode status lulus!\n";
+}
+
+/// <summary>
+/// 27) Kode numerik untuk label <see cref="classifyNumber"/>, agar hasil klasifikasi dapat
+/// disimpan sebagai kolom byte tanpa alokasi string.
+/// </summary>
+enum class NumberClass : uint8_t { Unknown, PositiveEven, PositiveOdd, NegativeEven, NegativeOdd };
+
+/// <summary>
+/// Padanan <see cref="classifyNumber"/> yang mengembalikan <see cref="NumberClass"/>; tanpa cabang.
+/// </summary>
+inline NumberClass classifyNumberCode(int value) {
+    const unsigned odd = static_cast<unsigned>(value) & 1u;
+    const unsigned code = (value > 0 ? 1u + odd : 0u) + (value < 0 ? 3u + odd : 0u);
+    return static_cast<NumberClass>(code);
+}
+
+/// <summary>Label teks yang sama dengan keluaran <see cref="classifyNumber"/>.</summary>
+inline const char* numberClassLabel(NumberClass numberClass) {
+    switch (numberClass) {
+    case NumberClass::PositiveEven: return "Positif dan Genap";
+    case NumberClass::PositiveOdd: return "Positif dan Ganjil";
+    case NumberClass::NegativeEven: return "Negatif dan Genap";
+    case NumberClass::NegativeOdd: return "Negatif dan Ganjil";
+    default: return "Klasifikasi Tidak Dikenal";
+    }
+}
+
+/// <summary>Tahap pipeline: <see cref="processValue"/> berhasil.</summary>
+struct ProcessValueStage {
+    static const bool kCheap = true;
+    static const uint8_t kFlag = 1;
+    static bool test(int value) { return processValue(value) == Status::Success; }
+};
+
+/// <summary>Tahap pipeline: <see cref="checkRange"/> berhasil.</summary>
+struct CheckRangeStage {
+    static const bool kCheap = true;
+    static const uint8_t kFlag = 2;
+    static bool test(int value) { return checkRange(value) == Status::Success; }
+};
+
+/// <summary>Tahap pipeline: <see cref="isPrime"/>.</summary>
+struct IsPrimeStage {
+    static const bool kCheap = false;
+    static const uint8_t kFlag = 4;
+    static bool test(int value) { return isPrime(value); }
+};
+
+/// <summary>Jumlah elemen per blok pipeline terfusi (16 KiB masukan, muat di L1 bersama keluarannya).</summary>
+const size_t kFusedBlockSize = 4096;
+
+template <uint8_t Previous>
+void applyFusedStages(const int*, size_t, uint8_t*) {}
+
+/// <summary>
+/// Menjalankan tahap-tahap atas satu blok secara berurutan. Tahap pertama memeriksa semua
+/// elemen; tahap berikutnya hanya elemen yang lolos tahap sebelumnya (short-circuit), sehingga
+/// tahap mahal seperti <see cref="IsPrimeStage"/> hanya menyentuh penyintas. Tahap dengan
+/// kCheap = true dievaluasi untuk semua elemen tanpa cabang lalu di-AND dengan gerbang.
+/// </summary>
+template <uint8_t Previous, typename Stage, typename... Rest>
+void applyFusedStages(const int* values, size_t count, uint8_t* flags) {
+    if (Stage::kCheap) {
+        // Predikat murah dievaluasi tanpa cabang agar tidak salah prediksi dan dapat divektorisasi.
+        for (size_t i = 0; i < count; ++i) {
+            const unsigned gate = (Previous == 0 || (flags[i] & Previous) != 0) ? 1u : 0u;
+            const unsigned pass = gate & (Stage::test(values[i]) ? 1u : 0u);
+            flags[i] = static_cast<uint8_t>(flags[i] | (pass * Stage::kFlag));
+        }
+    }
+    else {
+        for (size_t i = 0; i < count; ++i) {
+            const bool gate = Previous == 0 || (flags[i] & Previous) != 0;
+            if (gate && Stage::test(values[i])) flags[i] |= Stage::kFlag;
+        }
+    }
+    applyFusedStages<Stage::kFlag, Rest...>(values, count, flags);
+}
+
+/// <summary>
+/// Pipeline predikat terfusi: klasifikasi dan rantai tahap <typeparamref name="Stages"/>
+/// dievaluasi blok demi blok dalam satu lintasan atas kolom masukan.
+/// </summary>
+/// <typeparam name="Stages">Tahap berurutan, misalnya ProcessValueStage, CheckRangeStage, IsPrimeStage.</typeparam>
+/// <param name="values">Kolom masukan.</param>
+/// <param name="count">Jumlah elemen.</param>
+/// <param name="flags">Menerima OR dari kFlag tiap tahap yang lolos.</param>
+/// <param name="classes">Menerima <see cref="classifyNumberCode"/> tiap elemen.</param>
+/// <returns>Jumlah elemen yang lolos semua tahap.</returns>
+/// <remarks>
+/// Setiap blok dibaca dari memori sekali; lintasan tahap berikutnya mengenai L1. Pipeline
+/// tak terfusi membaca ulang seluruh kolom dan perantara untuk setiap fungsi.
+/// </remarks>
+template <typename... Stages>
+size_t fusedPredicatePipeline(const int* values, size_t count, uint8_t* flags, NumberClass* classes) {
+    const uint8_t allFlags[] = { 0, Stages::kFlag... };
+    uint8_t required = 0;
+    for (uint8_t flag : allFlags) required |= flag;
+
+    size_t passed = 0;
+    for (size_t begin = 0; begin < count; begin += kFusedBlockSize) {
+        const size_t size = std::min(kFusedBlockSize, count - begin);
+        const int* block = values + begin;
+        uint8_t* blockFlags = flags + begin;
+        for (size_t i = 0; i < size; ++i) {
+            classes[begin + i] = classifyNumberCode(block[i]);
+            blockFlags[i] = 0;
+        }
+        applyFusedStages<0, Stages...>(block, size, blockFlags);
+        for (size_t i = 0; i < size; ++i) passed += (blockFlags[i] == required) ? 1 : 0;
+    }
+    return passed;
+}
+
+/// <summary>
+/// Pembanding tak terfusi untuk processValue, checkRange, classifyNumber, isPrime: satu
+/// lintasan penuh per fungsi dengan kolom perantara, seperti job ingest lama.
+/// </summary>
+/// <returns>Jumlah elemen yang lolos ketiga predikat.</returns>
+size_t unfusedPredicatePipeline(const int* values, size_t count, uint8_t* flags, NumberClass* classes) {
+    std::vector<Status> processed(count), ranged(count);
+    for (size_t i = 0; i < count; ++i) processed[i] = processValue(values[i]);
+    for (size_t i = 0; i < count; ++i) ranged[i] = checkRange(values[i]);
+    for (size_t i = 0; i < count; ++i) classes[i] = classifyNumberCode(values[i]);
+    size_t passed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t flag = 0;
+        if (processed[i] == Status::Success) {
+            flag |= ProcessValueStage::kFlag;
+            if (ranged[i] == Status::Success) {
+                flag |= CheckRangeStage::kFlag;
+                if (isPrime(values[i])) flag |= IsPrimeStage::kFlag;
+            }
+        }
+        flags[i] = flag;
+        passed += (flag == 7) ? 1 : 0;
+    }
+    return passed;
+}
+
+/// <summary>
+/// Hasil pengukuran pipeline terfusi vs tak terfusi.
+/// </summary>
+/// <remarks>
+/// Waktu dan throughput diukur; byte "model" hanyalah perkiraan lalu lintas memori per
+/// lintasan (baca + tulis) yang dihitung dari ukuran tipe, bukan hasil pengukuran.
+/// </remarks>
+struct FusionMeasurement {
+    double fusedSeconds;
+    double unfusedSeconds;
+    double fusedValuesPerSecond;
+    double unfusedValuesPerSecond;
+    uint64_t fusedModelBytes;
+    uint64_t unfusedModelBytes;
+    bool identical;              // kedua pipeline menghasilkan flag, kelas, dan jumlah yang sama
+};
+
+/// <summary>
+/// Mengukur waktu dan throughput pipeline terfusi dan tak terfusi, dan membandingkan hasilnya.
+/// </summary>
+/// <param name="values">Kolom masukan; sebaiknya jauh lebih besar dari cache terakhir.</param>
+/// <param name="repetitions">Jumlah pengulangan; diambil waktu terbaik.</param>
+FusionMeasurement measurePipelineFusion(const std::vector<int>& values, int repetitions) {
+    const size_t count = values.size();
+    std::vector<uint8_t> fusedFlags(count), unfusedFlags(count);
+    std::vector<NumberClass> fusedClasses(count), unfusedClasses(count);
+    FusionMeasurement result;
+    result.fusedSeconds = result.unfusedSeconds = 1e300;
+    result.identical = true;
+    for (int r = 0; r < repetitions; ++r) {
+        auto begin = std::chrono::steady_clock::now();
+        const size_t fusedPassed = fusedPredicatePipeline<ProcessValueStage, CheckRangeStage, IsPrimeStage>(
+            values.data(), count, fusedFlags.data(), fusedClasses.data());
+        auto middle = std::chrono::steady_clock::now();
+        const size_t unfusedPassed = unfusedPredicatePipeline(values.data(), count, unfusedFlags.data(), unfusedClasses.data());
+        auto end = std::chrono::steady_clock::now();
+        result.fusedSeconds = std::min(result.fusedSeconds, std::chrono::duration<double>(middle - begin).count());
+        result.unfusedSeconds = std::min(result.unfusedSeconds, std::chrono::duration<double>(end - middle).count());
+        result.identical = result.identical && fusedPassed == unfusedPassed && fusedFlags == unfusedFlags &&
+            fusedClasses == unfusedClasses;
+    }
+    result.fusedValuesPerSecond = count / result.fusedSeconds;
+    result.unfusedValuesPerSecond = count / result.unfusedSeconds;
+    const uint64_t n = count;
+    result.fusedModelBytes = n * (sizeof(int) + sizeof(uint8_t) + sizeof(NumberClass));
+    result.unfusedModelBytes = n * (2 * (sizeof(int) + sizeof(Status))     // processValue, checkRange
+        + (sizeof(int) + sizeof(NumberClass))                              // classifyNumber
+        + (sizeof(int) + 2 * sizeof(Status) + sizeof(uint8_t)));           // gabungan + isPrime
+    return result;
+}
+
+/// <summary>
+/// Kumpulan uji untuk pipeline predikat terfusi.
+/// </summary>
+void testPipelineFusion() {
+    for (int value : { -3, -2, 0, 1, 2 }) {
+        assert(numberClassLabel(classifyNumberCode(value)) == classifyNumber(value));
+    }
+    assert(numberClassLabel(classifyNumberCode(INT32_MIN)) == classifyNumber(INT32_MIN));
+    assert(numberClassLabel(classifyNumberCode(INT32_MAX)) == classifyNumber(INT32_MAX));
+
+    Xoshiro256StarStar rng(67);
+    std::vector<int> values(100000);
+    for (int& value : values) value = static_cast<int>(rng() % 300) - 100;
+    values[0] = INT32_MIN;
+    values[1] = INT32_MAX;
+
+    std::vector<uint8_t> fusedFlags(values.size()), unfusedFlags(values.size());
+    std::vector<NumberClass> fusedClasses(values.size()), unfusedClasses(values.size());
+    const size_t fusedPassed = fusedPredicatePipeline<ProcessValueStage, CheckRangeStage, IsPrimeStage>(
+        values.data(), values.size(), fusedFlags.data(), fusedClasses.data());
+    const size_t unfusedPassed = unfusedPredicatePipeline(values.data(), values.size(), unfusedFlags.data(), unfusedClasses.data());
+    assert(fusedPassed == unfusedPassed && fusedPassed > 0);
+    assert(fusedFlags == unfusedFlags && fusedClasses == unfusedClasses);
+
+    size_t expectedPassed = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        const int v = values[i];
+        const bool process = processValue(v) == Status::Success;
+        const bool range = process && checkRange(v) == Status::Success;
+        const bool prime = range && isPrime(v);
+        assert(fusedFlags[i] == (process ? 1 : 0) + (range ? 2 : 0) + (prime ? 4 : 0));
+        expectedPassed += prime ? 1 : 0;
+    }
+    assert(fusedPassed == expectedPassed);
+
+    // Komposisi lain: hanya checkRange lalu isPrime.
+    const size_t rangePrimes = fusedPredicatePipeline<CheckRangeStage, IsPrimeStage>(
+        values.data(), values.size(), fusedFlags.data(), fusedClasses.data());
+    assert(rangePrimes == expectedPassed);
+
+    // Kolom besar dengan sedikit penyintas agar lalu lintas memori yang dominan, bukan isPrime.
+    std::vector<int> column(1 << 22);
+    for (int& value : column) value = static_cast<int>(rng() % 20000) - 5000;
+    const FusionMeasurement measurement = measurePipelineFusion(column, 2);
+    assert(measurement.identical);
+    std::cout << "Terfusi " << measurement.fusedSeconds * 1e3 << " ms (" << measurement.fusedValuesPerSecond / 1e6
+        << " juta nilai/detik), tak terfusi " << measurement.unfusedSeconds * 1e3 << " ms ("
+        << measurement.unfusedValuesPerSecond / 1e6 << " juta nilai/detik)\n";
+    std::cout << "Lalu lintas memori model: terfusi " << measurement.fusedModelBytes / (1 << 20) << " MiB, tak terfusi "
+        << measurement.unfusedModelBytes / (1 << 20) << " MiB\n";
+
+    std::cout << "Semua uji pipeline terfusi lulus!\n";
+}
+
+/// <summary>
+/// Jumlah nilai di rentang tertutup [low, high] (low &lt;= high) dengan pemindaian linear.
+/// </summary>
+/// <remarks>
+/// Satu perbandingan tak bertanda per elemen (v - low &lt;= high - low) tanpa cabang, sehingga
+/// kompiler memvektorisasi loop (SSE2/AVX2). Penghitung 32-bit per potongan 2^31 elemen.
+/// </remarks>
+uint64_t countInRangeScan(const int* values, size_t count, int low, int high) {
+    const uint32_t width = static_cast<uint32_t>(high) - static_cast<uint32_t>(low);
+    const uint32_t offset = static_cast<uint32_t>(low);
+    uint64_t total = 0;
+    for (size_t begin = 0; begin < count; begin += (1u << 31)) {
+        const size_t end = std::min<size_t>(count, begin + (1u << 31));
+        uint32_t matches = 0;
+        for (size_t i = begin; i < end; ++i) {
+            matches += (static_cast<uint32_t>(values[i]) - offset <= width) ? 1u : 0u;
+        }
+        total += matches;
+    }
+    return total;
+}
+
+/// <summary>
+/// Statistik satu pemindaian <see cref="ColumnFile"/>.
+/// </summary>
+struct ColumnScanStats {
+    uint64_t matches;        // jumlah nilai yang memenuhi predikat
+    uint64_t blocksTotal;    // jumlah blok dalam berkas
+    uint64_t blocksSkipped;  // blok yang dilewati karena zone map tidak beririsan
+    uint64_t blocksCovered;  // blok yang seluruhnya cocok menurut zone map (tanpa membaca data)
+    uint64_t blocksScanned;  // blok yang datanya benar-benar dibaca
+    uint64_t bytesTouched;   // byte data yang dibaca
+};
+
+/// <summary>
+/// 28) Berkas kolom int32 berblok dengan zone map min/max per blok.
+/// </summary>
+/// <remarks>
+/// Tata letak (kata 64-bit little-endian seperti format tabel kombinatorika): magic, versi,
+/// jumlah nilai, ukuran blok, jumlah blok, offset data; lalu pasangan (min, max) per blok;
+/// lalu nilai int32 little-endian mulai dari offset yang sejajar halaman 4 KiB.
+/// Berkas dipetakan ke memori (mmap / MapViewOfFile), sehingga hanya halaman dari blok yang
+/// benar-benar dipindai yang dibaca dari disk. Data dibaca langsung dari pemetaan, jadi
+/// host harus little-endian (x86, x64, ARM64).
+/// </remarks>
+class ColumnFile {
+public:
+    /// <summary>Ukuran blok default (64 KiB data per blok).</summary>
+    static const uint64_t kDefaultBlockSize = 16384;
+
+    /// <summary>
+    /// Menulis kolom ke berkas beserta zone map-nya.
+    /// </summary>
+    /// <exception cref="std::invalid_argument">Bila blockSize nol.</exception>
+    /// <exception cref="std::runtime_error">Bila berkas tidak dapat ditulis.</exception>
+    static void write(const std::string& path, const std::vector<int>& values, uint64_t blockSize = kDefaultBlockSize) {
+        if (blockSize == 0) {
+            throw std::invalid_argument("Ukuran blok harus positif");
+        }
+        const uint64_t count = values.size();
+        const uint64_t blocks = (count + blockSize - 1) / blockSize;
+        const uint64_t dataOffset = alignToPage(kHeaderWords * 8 + blocks * 16);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        writeTableWord(out, kMagic);
+        writeTableWord(out, kVersion);
+        writeTableWord(out, count);
+        writeTableWord(out, blockSize);
+        writeTableWord(out, blocks);
+        writeTableWord(out, dataOffset);
+        for (uint64_t b = 0; b < blocks; ++b) {
+            const auto first = values.begin() + static_cast<ptrdiff_t>(b * blockSize);
+            const auto last = values.begin() + static_cast<ptrdiff_t>(std::min(count, (b + 1) * blockSize));
+            const auto range = std::minmax_element(first, last);
+            writeTableWord(out, static_cast<uint64_t>(static_cast<int64_t>(*range.first)));
+            writeTableWord(out, static_cast<uint64_t>(static_cast<int64_t>(*range.second)));
+        }
+        const std::vector<char> padding(static_cast<size_t>(dataOffset - (kHeaderWords * 8 + blocks * 16)), 0);
+        out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+
+        std::vector<char> buffer;
+        for (size_t begin = 0; begin < values.size(); begin += 65536) {
+            const size_t size = std::min<size_t>(65536, values.size() - begin);
+            buffer.resize(size * 4);
+            for (size_t i = 0; i < size; ++i) {
+                const uint32_t v = static_cast<uint32_t>(values[begin + i]);
+                for (int k = 0; k < 4; ++k) buffer[4 * i + k] = static_cast<char>(v >> (8 * k));
+            }
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+        if (!out) {
+            throw std::runtime_error("Gagal menulis berkas kolom");
+        }
+    }
+
+    /// <summary>
+    /// Membuka berkas kolom: membaca header dan zone map, lalu memetakan berkas ke memori.
+    /// </summary>
+    /// <exception cref="std::invalid_argument">Bila format berkas tidak valid.</exception>
+    /// <exception cref="std::runtime_error">Bila berkas tidak dapat dibuka atau dipetakan.</exception>
+    explicit ColumnFile(const std::string& path) : m_mapping(nullptr), m_mappedSize(0) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Berkas kolom tidak dapat dibuka");
+        }
+        uint64_t magic = 0, version = 0, dataOffset = 0;
+        if (!readTableWord(in, magic) || !readTableWord(in, version) || !readTableWord(in, m_count) ||
+            !readTableWord(in, m_blockSize) || !readTableWord(in, m_blockCount) || !readTableWord(in, dataOffset) ||
+            magic != kMagic || version != kVersion || m_blockSize == 0 ||
+            m_blockCount != m_count / m_blockSize + (m_count % m_blockSize != 0 ? 1 : 0)) {
+            throw std::invalid_argument("Header berkas kolom tidak valid");
+        }
+        // Header dicocokkan dengan ukuran berkas sebelum apa pun dialokasikan; semua batas
+        // dihitung dengan pembagian agar tidak ada perkalian yang overflow.
+        const std::istream::pos_type zoneStart = in.tellg();
+        in.seekg(0, std::ios::end);
+        const uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+        in.seekg(zoneStart);
+        if (m_blockCount > (fileSize - kHeaderWords * 8) / 16 || dataOffset % 4 != 0 ||
+            dataOffset < kHeaderWords * 8 + m_blockCount * 16 || dataOffset > fileSize ||
+            m_count > (fileSize - dataOffset) / 4) {
+            throw std::invalid_argument("Header berkas kolom tidak valid");
+        }
+        m_zoneMaps.resize(static_cast<size_t>(m_blockCount));
+        for (std::pair<int, int>& zone : m_zoneMaps) {
+            uint64_t low = 0, high = 0;
+            if (!readTableWord(in, low) || !readTableWord(in, high)) {
+                throw std::invalid_argument("Zone map terpotong");
+            }
+            zone.first = static_cast<int>(static_cast<int64_t>(low));
+            zone.second = static_cast<int>(static_cast<int64_t>(high));
+        }
+        in.close();
+
+        map(path, dataOffset);
+        // Berkas dapat berubah di antara pembacaan header dan pemetaan: periksa ulang terhadap pemetaan.
+        if (m_count > (m_mappedSize - dataOffset) / 4) {
+            unmap();
+            throw std::invalid_argument("Berkas kolom terpotong");
+        }
+        m_data = reinterpret_cast<const int*>(static_cast<const char*>(m_mapping) + dataOffset);
+    }
+
+    ~ColumnFile() { unmap(); }
+
+    ColumnFile(const ColumnFile&) = delete;
+    ColumnFile& operator=(const ColumnFile&) = delete;
+
+    uint64_t size() const { return m_count; }
+    uint64_t blockSize() const { return m_blockSize; }
+
+    /// <summary>Nilai kolom langsung dari pemetaan memori.</summary>
+    const int* data() const { return m_data; }
+    uint64_t blockCount() const { return m_blockCount; }
+
+    /// <summary>Zone map (min, max) blok ke-<paramref name="block"/>.</summary>
+    const std::pair<int, int>& zoneMap(uint64_t block) const { return m_zoneMaps[static_cast<size_t>(block)]; }
+
+    /// <summary>
+    /// Menghitung nilai di rentang tertutup [low, high] dengan pushdown predikat ke zone map.
+    /// </summary>
+    /// <remarks>
+    /// Predikat <see cref="checkRange"/> adalah [1, 100]; <see cref="processValue"/> sukses
+    /// adalah [0, INT_MAX]. Blok di luar rentang dilewati, blok yang seluruhnya di dalam
+    /// dihitung dari zone map saja, sisanya dipindai dengan loop tanpa cabang yang
+    /// divektorisasi oleh kompiler (SSE2/AVX2).
+    /// </remarks>
+    ColumnScanStats countInRange(int low, int high) const {
+        return scanBlocks(low, high, [&](uint64_t begin, uint64_t end, ColumnScanStats& s) {
+            s.matches += countInRangeScan(m_data + begin, static_cast<size_t>(end - begin), low, high);
+        });
+    }
+
+    /// <summary>
+    /// Seperti <see cref="countInRange"/>, tetapi juga menambahkan indeks baris yang cocok ke
+    /// <paramref name="rows"/>.
+    /// </summary>
+    ColumnScanStats selectInRange(int low, int high, std::vector<uint64_t>& rows) const {
+        return scanBlocks(low, high, [&](uint64_t begin, uint64_t end, ColumnScanStats& s) {
+            const uint32_t width = static_cast<uint32_t>(high) - static_cast<uint32_t>(low);
+            if (zoneInside(begin / m_blockSize, low, high)) {
+                for (uint64_t i = begin; i < end; ++i) rows.push_back(i);
+                s.matches += end - begin;
+                return;
+            }
+            for (uint64_t i = begin; i < end; ++i) {
+                if (static_cast<uint32_t>(m_data[i]) - static_cast<uint32_t>(low) <= width) {
+                    rows.push_back(i);
+                    ++s.matches;
+                }
+            }
+        }, true);
+    }
+
+private:
+    static const uint64_t kMagic = 0x314C4F434C505049ull; // "IPPLCOL1"
+    static const uint64_t kVersion = 1;
+    static const uint64_t kHeaderWords = 6;
+
+    static uint64_t alignToPage(uint64_t offset) { return (offset + 4095) & ~static_cast<uint64_t>(4095); }
+
+    bool zoneInside(uint64_t block, int low, int high) const {
+        const std::pair<int, int>& zone = m_zoneMaps[static_cast<size_t>(block)];
+        return zone.first >= low && zone.second <= high;
+    }
+
+    template <typename Scan>
+    ColumnScanStats scanBlocks(int low, int high, Scan&& scan, bool scanCovered = false) const {
+        ColumnScanStats stats = {};
+        stats.blocksTotal = m_blockCount;
+        if (low > high) {
+            stats.blocksSkipped = m_blockCount;
+            return stats;
+        }
+        for (uint64_t b = 0; b < m_blockCount; ++b) {
+            const std::pair<int, int>& zone = m_zoneMaps[static_cast<size_t>(b)];
+            const uint64_t begin = b * m_blockSize;
+            const uint64_t end = std::min(m_count, begin + m_blockSize);
+            if (zone.second < low || zone.first > high) {
+                ++stats.blocksSkipped;
+            }
+            else if (zone.first >= low && zone.second <= high) {
+                ++stats.blocksCovered;
+                if (scanCovered) scan(begin, end, stats);
+                else stats.matches += end - begin;
+            }
+            else {
+                ++stats.blocksScanned;
+                stats.bytesTouched += (end - begin) * 4;
+                willNeed(begin, end);
+                scan(begin, end, stats);
+            }
+        }
+        return stats;
+    }
+
+#if defined(_WIN32)
+    void map(const std::string& path, uint64_t expectedSize) {
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Berkas kolom tidak dapat dibuka");
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || static_cast<uint64_t>(fileSize.QuadPart) < expectedSize) {
+            CloseHandle(file);
+            throw std::invalid_argument("Berkas kolom terpotong");
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throw std::runtime_error("Berkas kolom tidak dapat dipetakan");
+        }
+        m_mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (m_mapping == nullptr) {
+            throw std::runtime_error("Berkas kolom tidak dapat dipetakan");
+        }
+        m_mappedSize = static_cast<size_t>(fileSize.QuadPart);
+    }
+
+    void unmap() {
+        if (m_mapping != nullptr) UnmapViewOfFile(m_mapping);
+    }
+
+    void willNeed(uint64_t, uint64_t) const {}
+#else
+    void map(const std::string& path, uint64_t expectedSize) {
+        const int file = open(path.c_str(), O_RDONLY);
+        if (file < 0) {
+            throw std::runtime_error("Berkas kolom tidak dapat dibuka");
+        }
+        struct stat info;
+        if (fstat(file, &info) != 0 || static_cast<uint64_t>(info.st_size) < expectedSize) {
+            close(file);
+            throw std::invalid_argument("Berkas kolom terpotong");
+        }
+        m_mappedSize = static_cast<size_t>(info.st_size);
+        void* mapping = mmap(nullptr, m_mappedSize, PROT_READ, MAP_SHARED, file, 0);
+        close(file);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Berkas kolom tidak dapat dipetakan");
+        }
+        m_mapping = mapping;
+    }
+
+    void unmap() {
+        if (m_mapping != nullptr) munmap(m_mapping, m_mappedSize);
+    }
+
+    /// <summary>Meminta kernel membaca halaman blok yang akan dipindai lebih dulu.</summary>
+    void willNeed(uint64_t begin, uint64_t end) const {
+        const uintptr_t first = reinterpret_cast<uintptr_t>(m_data + begin) & ~static_cast<uintptr_t>(4095);
+        const uintptr_t last = reinterpret_cast<uintptr_t>(m_data + end);
+        madvise(reinterpret_cast<void*>(first), last - first, MADV_WILLNEED);
+    }
+#endif
+
+    uint64_t m_count;
+    uint64_t m_blockSize;
+    uint64_t m_blockCount;
+    std::vector<std::pair<int, int>> m_zoneMaps;
+    void* m_mapping;
+    size_t m_mappedSize;
+    const int* m_data;
+};
+
+/// <summary>
+/// Berkas sementara untuk uji: nama unik per proses di direktori temp sistem, dihapus saat
+/// objek dihancurkan (juga bila uji gagal dengan exception).
+/// </summary>
+class TemporaryFile {
+public:
+    explicit TemporaryFile(const std::string& stem) {
+        static std::atomic<unsigned> counter(0);
+#if defined(_WIN32)
+        char directory[MAX_PATH + 1];
+        const DWORD length = GetTempPathA(MAX_PATH + 1, directory);
+        const std::string base = (length != 0 && length <= MAX_PATH) ? std::string(directory, length) : std::string(".\\");
+        const unsigned long process = GetCurrentProcessId();
+#else
+        const char* directory = std::getenv("TMPDIR");
+        const std::string base = std::string(directory != nullptr && *directory != 0 ? directory : "/tmp") + "/";
+        const unsigned long process = static_cast<unsigned long>(getpid());
+#endif
+        m_path = base + stem + "_" + std::to_string(process) + "_" + std::to_string(counter.fetch_add(1)) + ".bin";
+    }
+
+    ~TemporaryFile() {
+        if (!m_path.empty()) std::remove(m_path.c_str());
+    }
+
+    TemporaryFile(TemporaryFile&& other) noexcept : m_path(std::move(other.m_path)) { other.m_path.clear(); }
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    const std::string& path() const { return m_path; }
+
+private:
+    std::string m_path;
+};
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="ColumnFile"/>.
+/// </summary>
+void testColumnScan() {
+    // Kolom mirip stempel waktu: naik perlahan dengan derau, jadi zone map sangat selektif.
+    Xoshiro256StarStar rng(68);
+    std::vector<int> values(1000000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i / 10) - 20000 + static_cast<int>(rng() % 200);
+    }
+    values[12345] = INT32_MIN;
+    values[999999] = INT32_MAX;
+
+    const TemporaryFile file("ippl_column_test");
+    const std::string& path = file.path();
+    ColumnFile::write(path, values, 4096);
+    {
+        ColumnFile column(path);
+        assert(column.size() == values.size() && column.blockCount() == 245);
+
+        const int ranges[][2] = { { 1, 100 }, { 0, INT32_MAX }, { 50000, 50999 }, { INT32_MIN, INT32_MAX },
+            { 200000, 300000 }, { 5, 4 }, { INT32_MIN, INT32_MIN } };
+        for (const auto& range : ranges) {
+            uint64_t expected = 0;
+            for (int v : values) expected += (v >= range[0] && v <= range[1]) ? 1 : 0;
+            const ColumnScanStats stats = column.countInRange(range[0], range[1]);
+            assert(stats.matches == expected);
+            assert(stats.blocksSkipped + stats.blocksCovered + stats.blocksScanned == stats.blocksTotal);
+
+            std::vector<uint64_t> rows;
+            assert(column.selectInRange(range[0], range[1], rows).matches == expected);
+            assert(rows.size() == expected);
+            for (uint64_t row : rows) assert(values[row] >= range[0] && values[row] <= range[1]);
+        }
+
+        // Kueri selektif hanya menyentuh sebagian kecil data.
+        const ColumnScanStats selective = column.countInRange(50000, 50999);
+        assert(selective.bytesTouched * 20 < values.size() * 4);
+        assert(selective.blocksSkipped > 240);
+    }
+
+    try {
+        ColumnFile missing(TemporaryFile("ippl_column_tidak_ada").path());
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+        // Ignored, really
+    }
+
+    // Header rusak: { count, blockSize, blockCount, dataOffset, ukuran berkas }.
+    const uint64_t malformed[][5] = {
+        { 1ull << 62, 1ull << 62, 1, 4096, 4100 },   // count * 4 overflow melewati akhir berkas
+        { 100, 100, 1, 4096, 4096 + 40 },            // data lebih pendek dari count
+        { 10, 10, 1, 4098, 4200 },                   // offset data tidak sejajar 4 byte
+        { 10, 10, 1, 48, 4200 },                     // offset data menimpa zone map
+        { 1ull << 40, 1, 1ull << 40, 4096, 4200 },   // blockCount jauh melebihi berkas
+        { 10, 10, 1, 8192, 4200 },                   // offset data di luar berkas
+    };
+    for (const auto& header : malformed) {
+        const TemporaryFile bad("ippl_column_rusak");
+        {
+            std::ofstream out(bad.path(), std::ios::binary | std::ios::trunc);
+            const uint64_t words[] = { 0x314C4F434C505049ull, 1, header[0], header[1], header[2], header[3], 0, 0 };
+            for (uint64_t word : words) writeTableWord(out, word);
+            const std::vector<char> rest(static_cast<size_t>(header[4]) - sizeof(words), 0);
+            out.write(rest.data(), static_cast<std::streamsize>(rest.size()));
+        }
+        try {
+            ColumnFile column(bad.path());
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {
+            // Ignored, really
+        }
+    }
+
+    std::cout << "Semua uji pemindaian kolom lulus!\n";
+}
+
+/// <summary>
+/// 29) lower_bound tanpa cabang: indeks elemen pertama &gt;= key dalam array terurut.
+/// </summary>
+/// <remarks>
+/// Ruang pencarian dibagi dua dengan pemilihan bersyarat (cmov) alih-alih cabang, sehingga
+/// jumlah iterasi tetap ceil(log2 n) dan tidak ada salah prediksi.
+/// </remarks>
+size_t lowerBoundBranchless(const int* data, size_t count, int key) {
+    if (count == 0) return 0;
+    const int* base = data;
+    size_t n = count;
+    while (n > 1) {
+        const size_t half = n / 2;
+        base = (base[half] < key) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<size_t>(base - data) + (*base < key ? 1 : 0);
+}
+
+/// <summary>
+/// Lapisan kueri rentang yang sadar keterurutan: <see cref="isSorted"/> diperiksa sekali saat
+/// konstruksi dan hasilnya di-cache. Untuk data terurut, jumlah dan ekstraksi rentang
+/// dijawab dengan dua pencarian biner O(log n); untuk data tak terurut, dipakai
+/// <see cref="countInRangeScan"/>.
+/// </summary>
+class SortedRangeIndex {
+public:
+    /// <summary>Tata letak pencarian untuk data terurut.</summary>
+    enum class Layout {
+        Sorted,    // pencarian biner tanpa cabang langsung di atas array
+        Eytzinger  // salinan berurutan BFS (heap) dengan prefetch; lebih ramah cache untuk n besar
+    };
+
+    /// <summary>Membangun indeks; memeriksa keterurutan sekali (O(n)).</summary>
+    explicit SortedRangeIndex(std::vector<int> values, Layout layout = Layout::Sorted)
+        : m_values(std::move(values)), m_sorted(isSorted(m_values)), m_layout(layout) {
+        if (m_sorted && layout == Layout::Eytzinger) {
+            m_eytzinger.resize(m_values.size() + 1);
+            m_ranks.resize(m_values.size() + 1);
+            size_t next = 0;
+            buildEytzinger(1, next);
+        }
+    }
+
+    /// <summary>Hasil <see cref="isSorted"/> yang di-cache.</summary>
+    bool sorted() const { return m_sorted; }
+
+    size_t size() const { return m_values.size(); }
+
+    /// <summary>Jumlah nilai di rentang tertutup [low, high]; O(log n) bila terurut.</summary>
+    uint64_t countInRange(int low, int high) const {
+        if (low > high) return 0;
+        if (!m_sorted) return countInRangeScan(m_values.data(), m_values.size(), low, high);
+        return upperBound(high) - lowerBound(low);
+    }
+
+    /// <summary>Jumlah nilai yang lolos <see cref="checkRange"/>.</summary>
+    uint64_t countCheckRange() const { return countInRange(1, 100); }
+
+    /// <summary>
+    /// Nilai di [low, high] sesuai urutan aslinya. Bila terurut, ini satu salinan kontigu;
+    /// bila tidak, pemadatan tanpa cabang.
+    /// </summary>
+    std::vector<int> extractInRange(int low, int high) const {
+        if (low > high) return std::vector<int>();
+        if (m_sorted) {
+            return std::vector<int>(m_values.begin() + static_cast<ptrdiff_t>(lowerBound(low)),
+                m_values.begin() + static_cast<ptrdiff_t>(upperBound(high)));
+        }
+        std::vector<int> result(m_values.size());
+        const uint32_t width = static_cast<uint32_t>(high) - static_cast<uint32_t>(low);
+        size_t size = 0;
+        for (int value : m_values) {
+            result[size] = value;
+            size += (static_cast<uint32_t>(value) - static_cast<uint32_t>(low) <= width) ? 1 : 0;
+        }
+        result.resize(size);
+        return result;
+    }
+
+private:
+    /// <summary>Mengisi tata letak Eytzinger dengan penelusuran in-order pohon implisit.</summary>
+    void buildEytzinger(size_t node, size_t& next) {
+        if (node > m_values.size()) return;
+        buildEytzinger(2 * node, next);
+        m_eytzinger[node] = m_values[next];
+        m_ranks[node] = next++;
+        buildEytzinger(2 * node + 1, next);
+    }
+
+    size_t lowerBound(int key) const {
+        if (m_layout == Layout::Sorted) return lowerBoundBranchless(m_values.data(), m_values.size(), key);
+        const size_t n = m_values.size();
+        size_t k = 1;
+        while (k <= n) {
+            if (16 * k <= n) prefetchRead(&m_eytzinger[16 * k]);
+            k = 2 * k + (m_eytzinger[k] < key ? 1 : 0);
+        }
+        // Buang langkah "ke kanan" terakhir beserta langkah kiri yang mengikutinya.
+        k >>= countTrailingZeros64(~static_cast<uint64_t>(k)) + 1;
+        return k == 0 ? n : m_ranks[k];
+    }
+
+    size_t upperBound(int key) const {
+        return key == INT32_MAX ? m_values.size() : lowerBound(key + 1);
+    }
+
+    std::vector<int> m_values;
+    bool m_sorted;
+    Layout m_layout;
+    std::vector<int> m_eytzinger;
+    std::vector<size_t> m_ranks;
+};
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="SortedRangeIndex"/> dan <see cref="lowerBoundBranchless"/>.
+/// </summary>
+void testSortedRangeIndex() {
+    Xoshiro256StarStar rng(69);
+    for (size_t size : { 0, 1, 2, 3, 7, 8, 100, 1000, 4097 }) {
+        std::vector<int> values(size);
+        for (int& value : values) value = static_cast<int>(rng() % 300) - 100;
+        if (size > 2) values[1] = INT32_MIN;
+        if (size > 3) values[2] = INT32_MAX;
+        std::vector<int> sortedValues = values;
+        std::sort(sortedValues.begin(), sortedValues.end());
+
+        for (int key = -105; key <= 205; key += 3) {
+            const size_t expected = static_cast<size_t>(std::lower_bound(sortedValues.begin(), sortedValues.end(), key) - sortedValues.begin());
+            assert(lowerBoundBranchless(sortedValues.data(), sortedValues.size(), key) == expected);
+        }
+
+        const SortedRangeIndex plain(sortedValues);
+        const SortedRangeIndex eytzinger(sortedValues, SortedRangeIndex::Layout::Eytzinger);
+        const SortedRangeIndex unsorted(values);
+        assert(plain.sorted() && eytzinger.sorted());
+        assert(unsorted.sorted() == isSorted(values));
+
+        const int ranges[][2] = { { 1, 100 }, { -100, 199 }, { 50, 50 }, { 5, 4 }, { INT32_MIN, INT32_MAX },
+            { INT32_MIN, INT32_MIN }, { INT32_MAX, INT32_MAX }, { 300, 400 } };
+        for (const auto& range : ranges) {
+            std::vector<int> expected;
+            for (int v : values) {
+                if (v >= range[0] && v <= range[1]) expected.push_back(v);
+            }
+            assert(plain.countInRange(range[0], range[1]) == expected.size());
+            assert(eytzinger.countInRange(range[0], range[1]) == expected.size());
+            assert(unsorted.countInRange(range[0], range[1]) == expected.size());
+            assert(unsorted.extractInRange(range[0], range[1]) == expected);
+            std::sort(expected.begin(), expected.end());
+            assert(plain.extractInRange(range[0], range[1]) == expected);
+            assert(eytzinger.extractInRange(range[0], range[1]) == expected);
+        }
+        assert(plain.countCheckRange() == unsorted.countCheckRange());
+    }
+
+    std::cout << "Semua uji indeks rentang terurut lulus!\n";
+}
+
+/// <summary>
+/// 30) Irisan dua himpunan terurut dengan merge skalar tanpa cabang.
+/// </summary>
+/// <remarks>Semua kernel himpunan mensyaratkan masukan terurut naik tanpa duplikat.</remarks>
+template <typename T>
+size_t intersectSortedScalar(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        const T x = a[i], y = b[j];
+        out[k] = x;
+        k += (x == y) ? 1 : 0;
+        i += (x <= y) ? 1 : 0;
+        j += (y <= x) ? 1 : 0;
+    }
+    return k;
+}
+
+/// <summary>
+/// Irisan dengan galloping: tiap elemen himpunan kecil dicari di himpunan besar dengan
+/// pencarian eksponensial lalu biner, O(ns log(nl / ns)).
+/// </summary>
+template <typename T>
+size_t intersectSortedGalloping(const T* small, size_t ns, const T* large, size_t nl, T* out) {
+    size_t k = 0, low = 0;
+    for (size_t i = 0; i < ns && low < nl; ++i) {
+        const T x = small[i];
+        size_t high = low, step = 1;
+        while (high < nl && large[high] < x) {
+            low = high + 1;
+            high += step;
+            step *= 2;
+        }
+        low = static_cast<size_t>(std::lower_bound(large + low, large + std::min(high, nl), x) - large);
+        if (low < nl && large[low] == x) out[k++] = x;
+    }
+    return k;
+}
+
+/// <summary>Gabungan terurut (duplikat dipertahankan) dengan merge skalar tanpa cabang.</summary>
+template <typename T>
+size_t mergeSortedScalar(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        const bool takeB = b[j] < a[i];
+        out[k++] = takeB ? b[j] : a[i];
+        j += takeB ? 1 : 0;
+        i += takeB ? 0 : 1;
+    }
+    std::copy(a + i, a + na, out + k);
+    std::copy(b + j, b + nb, out + k + (na - i));
+    return k + (na - i) + (nb - j);
+}
+
+/// <summary>Membuang duplikat berurutan di tempat tanpa cabang; mengembalikan panjang baru.</summary>
+template <typename T>
+size_t dedupSortedScalar(T* values, size_t count) {
+    if (count == 0) return 0;
+    size_t kept = 1;
+    for (size_t i = 1; i < count; ++i) {
+        const T value = values[i];
+        values[kept] = value;
+        kept += (value != values[kept - 1]) ? 1 : 0;
+    }
+    return kept;
+}
+
+#if defined(IPPL_HAVE_SSE2)
+/// <summary>Menulis elemen lajur yang bit-nya menyala di <paramref name="mask"/>, berurutan.</summary>
+template <typename T>
+inline size_t emitMaskedLanes(const T* lanes, unsigned mask, T* out) {
+    size_t k = 0;
+    while (mask != 0) {
+        out[k++] = lanes[countTrailingZeros64(mask)];
+        mask &= mask - 1;
+    }
+    return k;
+}
+
+/// <summary>
+/// Irisan int32 SSE2: blok 4x4 dibandingkan dengan empat rotasi (pshufd), lalu blok dengan
+/// maksimum lebih kecil dimajukan.
+/// </summary>
+inline size_t intersectSortedBlocks(const int32_t* a, size_t na, const int32_t* b, size_t nb, int32_t* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i + 4 <= na && j + 4 <= nb) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i eq = _mm_cmpeq_epi32(va, vb);
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+        k += emitMaskedLanes(a + i, static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(eq))), out + k);
+        const int32_t maxA = a[i + 3], maxB = b[j + 3];
+        i += (maxA <= maxB) ? 4 : 0;
+        j += (maxB <= maxA) ? 4 : 0;
+    }
+    return k + intersectSortedScalar(a + i, na - i, b + j, nb - j, out + k);
+}
+
+/// <summary>
+/// Irisan int64 SSE2: blok 2x2; kesamaan 64-bit disusun dari dua perbandingan 32-bit karena
+/// pcmpeqq baru ada di SSE4.1.
+/// </summary>
+inline size_t intersectSortedBlocks(const int64_t* a, size_t na, const int64_t* b, size_t nb, int64_t* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i + 2 <= na && j + 2 <= nb) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        const __m128i straight = _mm_cmpeq_epi32(va, vb);
+        const __m128i crossed = _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2)));
+        const __m128i eq = _mm_or_si128(_mm_and_si128(straight, _mm_shuffle_epi32(straight, _MM_SHUFFLE(2, 3, 0, 1))),
+            _mm_and_si128(crossed, _mm_shuffle_epi32(crossed, _MM_SHUFFLE(2, 3, 0, 1))));
+        k += emitMaskedLanes(a + i, static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(eq))), out + k);
+        const int64_t maxA = a[i + 1], maxB = b[j + 1];
+        i += (maxA <= maxB) ? 2 : 0;
+        j += (maxB <= maxA) ? 2 : 0;
+    }
+    return k + intersectSortedScalar(a + i, na - i, b + j, nb - j, out + k);
+}
+
+// SSE2 belum punya pminsd/pmaxsd (SSE4.1); min/max dibentuk dari pcmpgtd dan blend bitwise.
+inline __m128i minEpi32(__m128i a, __m128i b) {
+    const __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+}
+
+inline __m128i maxEpi32(__m128i a, __m128i b) {
+    const __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+}
+
+/// <summary>Mengurutkan vektor bitonik 4 lajur (jarak 2 lalu jarak 1).</summary>
+inline __m128i bitonicClean4(__m128i v) {
+    const __m128i lowPair = _mm_set_epi32(0, 0, -1, -1);
+    const __m128i evenLanes = _mm_set_epi32(0, -1, 0, -1);
+    __m128i t = _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm_or_si128(_mm_and_si128(lowPair, minEpi32(v, t)), _mm_andnot_si128(lowPair, maxEpi32(v, t)));
+    t = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_and_si128(evenLanes, minEpi32(v, t)), _mm_andnot_si128(evenLanes, maxEpi32(v, t)));
+}
+
+/// <summary>
+/// Jaringan merge bitonik 4+4: <paramref name="low"/> menerima empat terkecil dan
+/// <paramref name="high"/> empat terbesar, keduanya terurut.
+/// </summary>
+inline void bitonicMerge4(__m128i& low, __m128i& high) {
+    const __m128i reversed = _mm_shuffle_epi32(high, _MM_SHUFFLE(0, 1, 2, 3));
+    const __m128i l = minEpi32(low, reversed);
+    const __m128i h = maxEpi32(low, reversed);
+    low = bitonicClean4(l);
+    high = bitonicClean4(h);
+}
+
+/// <summary>
+/// Merge int32 dengan jaringan merge SSE2: tiap langkah memuat blok 4 dari larik yang
+/// kepalanya lebih kecil dan mengeluarkan empat elemen terkecil.
+/// </summary>
+inline size_t mergeSortedBlocks(const int32_t* a, size_t na, const int32_t* b, size_t nb, int32_t* out) {
+    if (na < 4 || nb < 4) return mergeSortedScalar(a, na, b, nb, out);
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+    __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    size_t i = 4, j = 4, k = 0;
+    for (;;) {
+        bitonicMerge4(low, high);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k), low);
+        k += 4;
+        const bool takeA = j >= nb || (i < na && a[i] <= b[j]);
+        if (takeA ? i + 4 > na : j + 4 > nb) break;
+        low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(takeA ? a + i : b + j));
+        (takeA ? i : j) += 4;
+    }
+    // Sisa: empat elemen di register ditambah ekor kedua larik.
+    int32_t pending[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pending), high);
+    std::vector<int32_t> merged(4 + (na - i));
+    mergeSortedScalar(pending, 4, a + i, na - i, merged.data());
+    return k + mergeSortedScalar(merged.data(), merged.size(), b + j, nb - j, out + k);
+}
+
+/// <summary>
+/// Dedup int32 di tempat dengan SSE2: tiap blok dibandingkan dengan dirinya yang digeser satu
+/// lajur (beban tak sejajar dari p - 1); blok tanpa duplikat disalin utuh.
+/// </summary>
+inline size_t dedupSortedBlocks(int32_t* values, size_t count) {
+    if (count < 2) return count;
+    size_t kept = 1, i = 1;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        const __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i - 1));
+        const unsigned duplicates = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(current, previous))));
+        if (duplicates == 0) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(values + kept), current);
+            kept += 4;
+        }
+        else {
+            int32_t lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), current);
+            kept += emitMaskedLanes(lanes, ~duplicates & 0xFu, values + kept);
+        }
+    }
+    for (; i < count; ++i) {
+        const int32_t value = values[i];
+        values[kept] = value;
+        kept += (value != values[kept - 1]) ? 1 : 0;
+    }
+    return kept;
+}
+#else
+inline size_t intersectSortedBlocks(const int32_t* a, size_t na, const int32_t* b, size_t nb, int32_t* out) {
+    return intersectSortedScalar(a, na, b, nb, out);
+}
+
+inline size_t intersectSortedBlocks(const int64_t* a, size_t na, const int64_t* b, size_t nb, int64_t* out) {
+    return intersectSortedScalar(a, na, b, nb, out);
+}
+
+inline size_t mergeSortedBlocks(const int32_t* a, size_t na, const int32_t* b, size_t nb, int32_t* out) {
+    return mergeSortedScalar(a, na, b, nb, out);
+}
+
+inline size_t dedupSortedBlocks(int32_t* values, size_t count) { return dedupSortedScalar(values, count); }
+#endif
+
+inline size_t mergeSortedBlocks(const int64_t* a, size_t na, const int64_t* b, size_t nb, int64_t* out) {
+    return mergeSortedScalar(a, na, b, nb, out);
+}
+
+inline size_t dedupSortedBlocks(int64_t* values, size_t count) { return dedupSortedScalar(values, count); }
+
+/// <summary>Rasio ukuran di atas mana irisan beralih ke galloping.</summary>
+const size_t kGallopingRatio = 32;
+
+/// <summary>Ukuran total minimum sebelum operasi himpunan dipartisi ke beberapa thread.</summary>
+const size_t kParallelSetThreshold = 1 << 16;
+
+template <typename T>
+size_t intersectSortedKernel(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    if (na * kGallopingRatio < nb) return intersectSortedGalloping(a, na, b, nb, out);
+    if (nb * kGallopingRatio < na) return intersectSortedGalloping(b, nb, a, na, out);
+    return intersectSortedBlocks(a, na, b, nb, out);
+}
+
+template <typename T>
+size_t unionSortedKernel(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    return dedupSortedBlocks(out, mergeSortedBlocks(a, na, b, nb, out));
+}
+
+/// <summary>
+/// Menjalankan operasi himpunan per partisi nilai: pivot diambil dari larik yang lebih besar,
+/// kedua larik dipotong dengan lower_bound pada pivot yang sama, sehingga partisi saling
+/// lepas dan hasilnya cukup disambung.
+/// </summary>
+template <typename T, typename Kernel>
+std::vector<T> partitionedSetOperation(const std::vector<T>& a, const std::vector<T>& b, unsigned threadCount,
+    bool sumCapacity, Kernel&& kernel) {
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    const std::vector<T>& pivots = a.size() >= b.size() ? a : b;
+    const size_t parts = (threadCount > 1 && a.size() + b.size() >= kParallelSetThreshold) ? 4 * threadCount : 1;
+
+    std::vector<size_t> cutA(parts + 1, a.size()), cutB(parts + 1, b.size());
+    cutA[0] = cutB[0] = 0;
+    for (size_t p = 1; p < parts; ++p) {
+        const T pivot = pivots[p * pivots.size() / parts];
+        cutA[p] = static_cast<size_t>(std::lower_bound(a.begin(), a.end(), pivot) - a.begin());
+        cutB[p] = static_cast<size_t>(std::lower_bound(b.begin(), b.end(), pivot) - b.begin());
+    }
+
+    std::vector<std::vector<T>> pieces(parts);
+    parallelFor(parts, threadCount, [&](size_t p) {
+        const size_t na = cutA[p + 1] - cutA[p], nb = cutB[p + 1] - cutB[p];
+        pieces[p].resize(sumCapacity ? na + nb : std::min(na, nb));
+        pieces[p].resize(kernel(a.data() + cutA[p], na, b.data() + cutB[p], nb, pieces[p].data()));
+    });
+    if (parts == 1) return std::move(pieces[0]);
+
+    std::vector<T> result;
+    size_t total = 0;
+    for (const std::vector<T>& piece : pieces) total += piece.size();
+    result.reserve(total);
+    for (const std::vector<T>& piece : pieces) result.insert(result.end(), piece.begin(), piece.end());
+    return result;
+}
+
+/// <summary>
+/// Irisan dua himpunan terurut (tanpa duplikat). Memakai galloping bila ukuran timpang,
+/// selain itu kernel blok SSE2; masukan besar dipartisi ke <paramref name="threadCount"/> thread.
+/// </summary>
+/// <remarks>Prasyarat keterurutan diperiksa dengan <see cref="isSorted"/> hanya di build debug.</remarks>
+std::vector<int32_t> sortedIntersection(const std::vector<int32_t>& a, const std::vector<int32_t>& b, unsigned threadCount = 1) {
+    assert(isSorted(a) && isSorted(b));
+    return partitionedSetOperation(a, b, threadCount, false, intersectSortedKernel<int32_t>);
+}
+
+/// <summary>Irisan himpunan terurut 64-bit; lihat overload int32.</summary>
+std::vector<int64_t> sortedIntersection(const std::vector<int64_t>& a, const std::vector<int64_t>& b, unsigned threadCount = 1) {
+    assert(isSorted(a) && isSorted(b));
+    return partitionedSetOperation(a, b, threadCount, false, intersectSortedKernel<int64_t>);
+}
+
+/// <summary>
+/// Gabungan dua himpunan terurut (tanpa duplikat): jaringan merge SSE2 lalu dedup.
+/// </summary>
+/// <remarks>Prasyarat keterurutan diperiksa dengan <see cref="isSorted"/> hanya di build debug.</remarks>
+std::vector<int32_t> sortedUnion(const std::vector<int32_t>& a, const std::vector<int32_t>& b, unsigned threadCount = 1) {
+    assert(isSorted(a) && isSorted(b));
+    return partitionedSetOperation(a, b, threadCount, true, unionSortedKernel<int32_t>);
+}
+
+/// <summary>Gabungan himpunan terurut 64-bit (merge skalar tanpa cabang); lihat overload int32.</summary>
+std::vector<int64_t> sortedUnion(const std::vector<int64_t>& a, const std::vector<int64_t>& b, unsigned threadCount = 1) {
+    assert(isSorted(a) && isSorted(b));
+    return partitionedSetOperation(a, b, threadCount, true, unionSortedKernel<int64_t>);
+}
+
+/// <summary>Membuang duplikat dari vektor terurut di tempat; mengembalikan jumlah elemen unik.</summary>
+size_t dedupSorted(std::vector<int32_t>& values) {
+    assert(isSorted(values));
+    values.resize(dedupSortedBlocks(values.data(), values.size()));
+    return values.size();
+}
+
+/// <summary>Dedup 64-bit di tempat; lihat overload int32.</summary>
+size_t dedupSorted(std::vector<int64_t>& values) {
+    assert(isSorted(values));
+    values.resize(dedupSortedBlocks(values.data(), values.size()));
+    return values.size();
+}
+
+/// <summary>
+/// Kumpulan uji untuk kernel himpunan terurut.
+/// </summary>
+void testSortedSetKernels() {
+    Xoshiro256StarStar rng(70);
+    auto randomSet = [&](size_t size, uint64_t range) {
+        std::vector<int64_t> values(size);
+        for (int64_t& value : values) value = static_cast<int64_t>(rng() % range) - static_cast<int64_t>(range / 2);
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        return values;
+    };
+    auto narrow = [](const std::vector<int64_t>& values) { return std::vector<int32_t>(values.begin(), values.end()); };
+
+    const size_t sizes[][2] = { { 0, 0 }, { 0, 10 }, { 3, 5 }, { 100, 100 }, { 1000, 1500 }, { 20, 50000 },
+        { 70000, 60000 }, { 200000, 100 } };
+    for (const auto& size : sizes) {
+        for (uint64_t range : { 64ull, 300000ull }) {
+            const std::vector<int64_t> a = randomSet(size[0], range), b = randomSet(size[1], range);
+            std::vector<int64_t> expectedIntersection, expectedUnion;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expectedIntersection));
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expectedUnion));
+
+            for (unsigned threads : { 1u, 4u }) {
+                assert(sortedIntersection(a, b, threads) == expectedIntersection);
+                assert(sortedIntersection(b, a, threads) == expectedIntersection);
+                assert(sortedUnion(a, b, threads) == expectedUnion);
+                assert(sortedIntersection(narrow(a), narrow(b), threads) == narrow(expectedIntersection));
+                assert(sortedUnion(narrow(a), narrow(b), threads) == narrow(expectedUnion));
+                assert(sortedUnion(narrow(b), narrow(a), threads) == narrow(expectedUnion));
+            }
+        }
+    }
+
+    // Nilai ekstrem memeriksa min/max bertanda di jaringan merge.
+    const std::vector<int32_t> extremesA = { INT32_MIN, -1, 0, 5, 6, 7, 8, INT32_MAX };
+    const std::vector<int32_t> extremesB = { INT32_MIN, 1, 2, 3, 4, 6, 9, 10, 11 };
+    assert(sortedUnion(extremesA, extremesB) ==
+        (std::vector<int32_t>{ INT32_MIN, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, INT32_MAX }));
+    assert(sortedIntersection(extremesA, extremesB) == (std::vector<int32_t>{ INT32_MIN, 6 }));
+
+    for (size_t size : { 0, 1, 5, 17, 1000 }) {
+        std::vector<int64_t> values(size);
+        for (int64_t& value : values) value = static_cast<int64_t>(rng() % 20);
+        std::sort(values.begin(), values.end());
+        std::vector<int64_t> expected = values;
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+        std::vector<int32_t> values32 = narrow(values);
+        assert(dedupSorted(values) == expected.size() && values == expected);
+        assert(dedupSorted(values32) == expected.size() && values32 == narrow(expected));
+    }
+
+    assert(isSorted(std::vector<int64_t>{ INT64_MIN, 0, 0, INT64_MAX }));
+    assert(!isSorted(std::vector<int64_t>{ 1, 0 }));
+
+    std::cout << "Semua uji kernel himpunan terurut lulus!\n";
+}
+
+/// <summary>
+/// 31) Padanan <see cref="isSorted"/> untuk rentang mentah, tanpa cabang di dalam blok.
+/// </summary>
+/// <remarks>
+/// Pelanggaran dalam satu blok 1024 elemen dikumpulkan dengan OR sehingga loop dapat
+/// divektorisasi; keluar lebih awal hanya di batas blok.
+/// </remarks>
+bool isSortedRange(const int* data, size_t count) {
+    for (size_t begin = 1; begin < count; begin += 1024) {
+        const size_t end = std::min(count, begin + 1024);
+        unsigned violations = 0;
+        for (size_t i = begin; i < end; ++i) violations |= (data[i] < data[i - 1]) ? 1u : 0u;
+        if (violations != 0) return false;
+    }
+    return true;
+}
+
+/// <summary>
+/// <see cref="isSortedRange"/> paralel: rentang dipotong menjadi potongan yang tumpang tindih
+/// satu elemen sehingga setiap pasangan bertetangga diperiksa tepat oleh satu potongan.
+/// </summary>
+/// <param name="threadCount">Jumlah thread; 0 berarti semua core.</param>
+bool isSortedParallel(const int* data, size_t count, unsigned threadCount = 0) {
+    if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+    if (threadCount == 1 || count < (1u << 16)) return isSortedRange(data, count);
+    const size_t chunks = 4 * static_cast<size_t>(threadCount);
+    const size_t chunkSize = (count + chunks - 1) / chunks;
+    std::atomic<bool> unsorted(false);
+    parallelFor(chunks, threadCount, [&](size_t c) {
+        const size_t begin = c * chunkSize;
+        if (begin >= count || unsorted.load(std::memory_order_relaxed)) return;
+        const size_t end = std::min(count, begin + chunkSize + 1);
+        if (!isSortedRange(data + begin, end - begin)) unsorted.store(true, std::memory_order_relaxed);
+    });
+    return !unsorted.load();
+}
+
+/// <summary>Overload vektor untuk <see cref="isSortedParallel"/>.</summary>
+bool isSortedParallel(const std::vector<int>& arr, unsigned threadCount = 0) {
+    return isSortedParallel(arr.data(), arr.size(), threadCount);
+}
+
+/// <summary>
+/// Hasil verifikasi keterurutan global atas shard.
+/// </summary>
+struct ShardedSortedness {
+    bool sorted;                      // true bila gabungan semua shard terurut
+    std::vector<uint8_t> shardSorted; // keterurutan internal tiap shard
+    size_t brokenBoundary;            // shard i dengan last(i) &gt; first(i+1) pertama, atau SIZE_MAX
+    double slowestShardSeconds;       // durasi shard paling lambat
+    double totalSeconds;              // durasi verifikasi keseluruhan
+};
+
+/// <summary>
+/// Memverifikasi bahwa gabungan shard (berkas <see cref="ColumnFile"/>, sesuai urutan) terurut
+/// tanpa menyambungnya.
+/// </summary>
+/// <param name="shardPaths">Berkas shard sesuai urutan global.</param>
+/// <param name="threadsPerShard">Thread <see cref="isSortedParallel"/> per shard.</param>
+/// <returns>Status per shard, batas pertama yang rusak, dan waktu.</returns>
+/// <exception cref="std::runtime_error">
+/// Bila shard tidak dapat dibaca, atau worker berhenti tidak normal (sinyalnya dilaporkan).
+/// </exception>
+/// <remarks>
+/// Di POSIX, setiap shard diperiksa di proses worker hasil fork yang memetakan berkasnya
+/// sendiri; hasil, elemen pertama/terakhir, dan durasi ditulis ke memori bersama anonim
+/// (MAP_SHARED). Paling banyak hardware_concurrency() / threadsPerShard worker berjalan
+/// bersamaan; worker yang selesai langsung dipanen lalu diganti shard berikutnya. Di Windows
+/// tidak ada fork, jadi shard diperiksa oleh <see cref="parallelFor"/> dengan batas yang sama.
+/// Proses induk hanya membandingkan pasangan batas dari slot tersebut, sehingga waktu total
+/// mengikuti shard paling lambat, bukan jumlah semuanya. Panggil dari konteks berthread
+/// tunggal tanpa proses anak lain, karena fork hanya menyalin thread pemanggil dan worker
+/// dipanen dengan waitpid(-1).
+/// </remarks>
+ShardedSortedness verifyShardedSortedness(const std::vector<std::string>& shardPaths, unsigned threadsPerShard = 1) {
+    struct ShardSlot {
+        uint8_t state; // 0 = belum, 1 = terurut, 2 = tidak terurut, 3 = galat
+        uint8_t empty;
+        int first;
+        int last;
+        double seconds;
+    };
+    const size_t count = shardPaths.size();
+    const unsigned concurrency = std::max(1u, std::max(1u, std::thread::hardware_concurrency()) / std::max(1u, threadsPerShard));
+    const auto start = std::chrono::steady_clock::now();
+    auto checkShard = [&](size_t s, ShardSlot& slot) {
+        const auto begin = std::chrono::steady_clock::now();
+        try {
+            const ColumnFile shard(shardPaths[s]);
+            const size_t size = static_cast<size_t>(shard.size());
+            slot.empty = size == 0 ? 1 : 0;
+            if (size != 0) {
+                slot.first = shard.data()[0];
+                slot.last = shard.data()[size - 1];
+            }
+            slot.state = isSortedParallel(shard.data(), size, threadsPerShard) ? 1 : 2;
+        }
+        catch (...) {
+            slot.state = 3;
+        }
+        slot.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    };
+
+    std::vector<ShardSlot> slots(count, ShardSlot{ 0, 1, 0, 0, 0.0 });
+#if defined(_WIN32)
+    parallelFor(count, concurrency, [&](size_t s) { checkShard(s, slots[s]); });
+#else
+    if (count > 0) {
+        const size_t sharedSize = count * sizeof(ShardSlot);
+        void* shared = mmap(nullptr, sharedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (shared == MAP_FAILED) {
+            throw std::runtime_error("Memori bersama tidak dapat dialokasikan");
+        }
+        ShardSlot* sharedSlots = static_cast<ShardSlot*>(shared);
+        std::fill(sharedSlots, sharedSlots + count, ShardSlot{ 0, 1, 0, 0, 0.0 });
+        std::vector<std::pair<pid_t, size_t>> running;
+        std::string failure;
+        size_t next = 0;
+        while (next < count || !running.empty()) {
+            if (next < count && running.size() < concurrency) {
+                const size_t s = next++;
+                const pid_t pid = fork();
+                if (pid == 0) {
+                    checkShard(s, sharedSlots[s]);
+                    _exit(0);
+                }
+                if (pid < 0) checkShard(s, sharedSlots[s]); // fork gagal: periksa di proses ini
+                else running.emplace_back(pid, s);
+                continue;
+            }
+            int status = 0;
+            const pid_t pid = waitpid(-1, &status, 0);
+            if (pid < 0) {
+                if (errno == EINTR) continue; // sinyal saat menunggu: worker masih berjalan
+                break;                        // ECHILD: tidak ada anak tersisa
+            }
+            const auto worker = std::find_if(running.begin(), running.end(),
+                [pid](const std::pair<pid_t, size_t>& entry) { return entry.first == pid; });
+            if (worker == running.end()) continue;
+            if (failure.empty() && WIFSIGNALED(status)) {
+                failure = "Worker shard " + shardPaths[worker->second] + " dihentikan sinyal " + std::to_string(WTERMSIG(status));
+            }
+            else if (failure.empty() && WIFEXITED(status) && WEXITSTATUS(status) != 0) {
+                failure = "Worker shard " + shardPaths[worker->second] + " keluar dengan kode " +
+                    std::to_string(WEXITSTATUS(status));
+            }
+            running.erase(worker);
+        }
+        std::copy(sharedSlots, sharedSlots + count, slots.begin());
+        munmap(shared, sharedSize);
+        if (!failure.empty()) {
+            throw std::runtime_error(failure);
+        }
+    }
+#endif
+
+    ShardedSortedness result;
+    result.sorted = true;
+    result.brokenBoundary = SIZE_MAX;
+    result.slowestShardSeconds = 0;
+    result.shardSorted.resize(count);
+    for (size_t s = 0; s < count; ++s) {
+        if (slots[s].state == 0 || slots[s].state == 3) {
+            throw std::runtime_error("Shard tidak dapat diperiksa: " + shardPaths[s]);
+        }
+        result.shardSorted[s] = slots[s].state == 1 ? 1 : 0;
+        result.sorted = result.sorted && slots[s].state == 1;
+        result.slowestShardSeconds = std::max(result.slowestShardSeconds, slots[s].seconds);
+    }
+
+    // Pasangan batas dari elemen pertama dan terakhir yang dilaporkan worker; shard kosong dilewati.
+    bool haveLast = false;
+    int last = 0;
+    for (size_t s = 0; s < count; ++s) {
+        if (slots[s].empty) continue;
+        if (haveLast && slots[s].first < last && result.brokenBoundary == SIZE_MAX) {
+            result.brokenBoundary = s - 1;
+            result.sorted = false;
+        }
+        last = slots[s].last;
+        haveLast = true;
+    }
+    result.totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="isSortedParallel"/> dan <see cref="verifyShardedSortedness"/>.
+/// </summary>
+void testShardedSortedness() {
+    std::vector<int> values(1 << 20);
+    for (size_t i = 0; i < values.size(); ++i) values[i] = static_cast<int>(i / 3) - 1000;
+    assert(isSortedParallel(values, 8) && isSortedRange(values.data(), values.size()));
+    for (size_t position : { size_t(1), size_t(1023), size_t(1024), values.size() / 32, values.size() - 1 }) {
+        std::swap(values[position - 1], values[position]);
+        const bool expected = isSorted(values);
+        assert(isSortedParallel(values, 8) == expected && isSortedRange(values.data(), values.size()) == expected);
+        std::swap(values[position - 1], values[position]);
+    }
+    assert(isSortedParallel(std::vector<int>(), 4) && isSortedParallel(std::vector<int>{ 7 }, 4));
+
+    // Empat shard terurut (satu kosong) dari satu barisan global.
+    const size_t cuts[] = { 0, 300000, 300000, 700000, values.size() };
+    std::vector<TemporaryFile> files;
+    std::vector<std::string> paths;
+    for (size_t s = 0; s < 4; ++s) {
+        files.emplace_back("ippl_shard");
+        paths.push_back(files.back().path());
+        ColumnFile::write(paths[s], std::vector<int>(values.begin() + static_cast<ptrdiff_t>(cuts[s]),
+            values.begin() + static_cast<ptrdiff_t>(cuts[s + 1])));
+    }
+    ShardedSortedness result = verifyShardedSortedness(paths, 2);
+    assert(result.sorted && result.brokenBoundary == SIZE_MAX);
+    assert(result.shardSorted == (std::vector<uint8_t>{ 1, 1, 1, 1 }));
+    assert(result.slowestShardSeconds <= result.totalSeconds);
+
+    // Batas rusak: shard 3 dimulai di bawah akhir shard 2 (shard kosong 1 dilewati).
+    ColumnFile::write(paths[2], std::vector<int>(values.begin() + static_cast<ptrdiff_t>(cuts[3]),
+        values.begin() + static_cast<ptrdiff_t>(cuts[4])));
+    ColumnFile::write(paths[3], std::vector<int>(values.begin() + static_cast<ptrdiff_t>(cuts[2]),
+        values.begin() + static_cast<ptrdiff_t>(cuts[3])));
+    result = verifyShardedSortedness(paths, 2);
+    assert(!result.sorted && result.brokenBoundary == 2);
+    assert(result.shardSorted == (std::vector<uint8_t>{ 1, 1, 1, 1 }));
+
+    // Shard yang rusak di dalam.
+    std::vector<int> broken(values.begin(), values.begin() + 1000);
+    std::swap(broken[10], broken[900]);
+    ColumnFile::write(paths[1], broken);
+    result = verifyShardedSortedness(paths, 1);
+    assert(!result.sorted && result.shardSorted[1] == 0);
+
+    // Jauh lebih banyak shard daripada core: worker dibatasi dan dipanen bergiliran.
+    std::vector<TemporaryFile> manyFiles;
+    std::vector<std::string> manyPaths;
+    for (size_t s = 0; s < 96; ++s) {
+        manyFiles.emplace_back("ippl_shard_kecil");
+        manyPaths.push_back(manyFiles.back().path());
+        ColumnFile::write(manyPaths[s], std::vector<int>(values.begin() + static_cast<ptrdiff_t>(s * 1000),
+            values.begin() + static_cast<ptrdiff_t>((s + 1) * 1000)));
+    }
+    std::swap(manyPaths[40], manyPaths[41]);
+    result = verifyShardedSortedness(manyPaths, 1);
+    assert(!result.sorted && result.brokenBoundary == 40);
+    assert(std::count(result.shardSorted.begin(), result.shardSorted.end(), 1) == 96);
+
+    try {
+        verifyShardedSortedness({ TemporaryFile("ippl_shard_tidak_ada").path() });
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji verifikasi shard lulus!\n";
+}
+
+/// <summary>
+/// 32) <see cref="isSorted"/> untuk double dengan urutan total: semua NaN dianggap sama dan
+/// terletak setelah semua bilangan (termasuk +inf), serta -0 == +0.
+/// </summary>
+/// <param name="arr">Vektor double.</param>
+/// <returns>True jika non-menurun menurut urutan tersebut.</returns>
+/// <remarks>
+/// Pasangan (prev, cur) melanggar bila cur &lt; prev, atau prev NaN sedangkan cur bukan NaN.
+/// Perbandingan IEEE sudah menyamakan -0 dan +0 serta bernilai salah untuk NaN, jadi kernel
+/// SSE2 cukup memakai cmplt, cmpunord, dan cmpord, dua lajur per langkah.
+/// </remarks>
+bool isSorted(const std::vector<double>& arr) {
+    const double* data = arr.data();
+    const size_t count = arr.size();
+    size_t i = 1;
+#if defined(IPPL_HAVE_SSE2)
+    for (; i + 2 <= count; i += 2) {
+        const __m128d previous = _mm_loadu_pd(data + i - 1);
+        const __m128d current = _mm_loadu_pd(data + i);
+        const __m128d violation = _mm_or_pd(_mm_cmplt_pd(current, previous),
+            _mm_and_pd(_mm_cmpunord_pd(previous, previous), _mm_cmpord_pd(current, current)));
+        if (_mm_movemask_pd(violation) != 0) return false;
+    }
+#endif
+    for (; i < count; ++i) {
+        const double previous = data[i - 1], current = data[i];
+        if (current < previous || (previous != previous && current == current)) return false;
+    }
+    return true;
+}
+
+/// <summary>
+/// Delapan byte pertama string sebagai bilangan big-endian (diisi nol), sehingga urutan
+/// bilangannya konsisten dengan urutan leksikografis byte tak bertanda.
+/// </summary>
+inline uint64_t stringPrefix64(const char* data, size_t size) {
+    unsigned char bytes[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    std::memcpy(bytes, data, std::min<size_t>(size, 8));
+    uint64_t prefix = 0;
+    for (int k = 0; k < 8; ++k) prefix = (prefix << 8) | bytes[k];
+    return prefix;
+}
+
+/// <summary>
+/// Kernel keterurutan string: bandingkan prefiks 8 byte lebih dulu; hanya bila prefiks sama
+/// dipakai memcmp atas sisa byte lalu panjang.
+/// </summary>
+/// <typeparam name="Text">Tipe dengan data() dan size(), misalnya std::string atau std::string_view.</typeparam>
+template <typename Text>
+bool isSortedText(const Text* texts, size_t count) {
+    if (count < 2) return true;
+    uint64_t previousPrefix = stringPrefix64(texts[0].data(), texts[0].size());
+    for (size_t i = 1; i < count; ++i) {
+        const uint64_t prefix = stringPrefix64(texts[i].data(), texts[i].size());
+        if (prefix < previousPrefix) return false;
+        if (prefix == previousPrefix) {
+            const Text& previous = texts[i - 1];
+            const Text& current = texts[i];
+            const size_t common = std::min(previous.size(), current.size());
+            const int order = common > 8 ? std::memcmp(previous.data() + 8, current.data() + 8, common - 8) : 0;
+            if (order > 0 || (order == 0 && previous.size() > current.size())) return false;
+        }
+        previousPrefix = prefix;
+    }
+    return true;
+}
+
+/// <summary>Overload <see cref="isSorted"/> untuk std::string (urutan leksikografis byte).</summary>
+bool isSorted(const std::vector<std::string>& arr) {
+    return isSortedText(arr.data(), arr.size());
+}
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+/// <summary>Overload <see cref="isSorted"/> untuk std::string_view (hanya C++17 ke atas).</summary>
+bool isSorted(const std::vector<std::string_view>& arr) {
+    return isSortedText(arr.data(), arr.size());
+}
+#endif
+
+/// <summary>
+/// Keterurutan leksikografis kunci komposit yang disimpan per kolom (struct-of-arrays):
+/// baris i terurut terhadap baris i-1 menurut (columns[0][i], columns[1][i], ...).
+/// </summary>
+/// <param name="columns">Kolom kunci, dari yang paling signifikan.</param>
+/// <returns>True jika baris-baris terurut non-menurun.</returns>
+/// <exception cref="std::invalid_argument">Bila panjang kolom berbeda.</exception>
+/// <remarks>
+/// Diproses per blok 1024 baris dan per kolom: tiap kolom menambah pelanggaran hanya pada
+/// baris yang masih seri pada kolom sebelumnya, lalu mempersempit status seri. Setiap loop
+/// kolom lurus tanpa cabang sehingga dapat divektorisasi.
+/// </remarks>
+bool isSortedLexicographic(const std::vector<std::vector<int64_t>>& columns) {
+    if (columns.empty()) return true;
+    const size_t rows = columns[0].size();
+    for (const std::vector<int64_t>& column : columns) {
+        if (column.size() != rows) {
+            throw std::invalid_argument("Panjang kolom kunci harus sama");
+        }
+    }
+    uint8_t tied[1024];
+    for (size_t begin = 1; begin < rows; begin += 1024) {
+        const size_t size = std::min<size_t>(1024, rows - begin);
+        unsigned violations = 0;
+        std::fill(tied, tied + size, 1);
+        for (const std::vector<int64_t>& column : columns) {
+            const int64_t* current = column.data() + begin;
+            const int64_t* previous = current - 1;
+            for (size_t i = 0; i < size; ++i) {
+                violations |= tied[i] & ((current[i] < previous[i]) ? 1u : 0u);
+                tied[i] = static_cast<uint8_t>(tied[i] & ((current[i] == previous[i]) ? 1u : 0u));
+            }
+        }
+        if (violations != 0) return false;
+    }
+    return true;
+}
+
+/// <summary>
+/// Kumpulan uji untuk varian <see cref="isSorted"/> double, string, dan kunci komposit.
+/// </summary>
+void testSpecializedIsSorted() {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    assert(isSorted(std::vector<double>{ -inf, -1.5, -0.0, 0.0, -0.0, 2.0, inf, nan, nan }));
+    assert(isSorted(std::vector<double>{ nan }));
+    assert(isSorted(std::vector<double>()));
+    assert(!isSorted(std::vector<double>{ 1.0, nan, 2.0 }));
+    assert(!isSorted(std::vector<double>{ nan, 1.0 }));
+    assert(!isSorted(std::vector<double>{ 0.0, -1e-300 }));
+    assert(!isSorted(std::vector<double>{ 1, 2, 3, 4, 5, 4.5 }));
+    assert(!isSorted(std::vector<double>{ 1, 2, 3, 4, 3, 5 }));
+
+    Xoshiro256StarStar rng(72);
+    for (int trial = 0; trial < 200; ++trial) {
+        std::vector<double> values(static_cast<size_t>(rng() % 12));
+        for (double& value : values) {
+            const uint64_t r = rng() % 8;
+            value = r == 0 ? nan : r == 1 ? -0.0 : static_cast<double>(static_cast<int>(r) - 4);
+        }
+        if (trial % 2 == 0) {
+            std::sort(values.begin(), values.end(), [](double a, double b) { return a < b || (a == a && b != b); });
+        }
+        bool expected = true;
+        for (size_t i = 1; i < values.size(); ++i) {
+            const int previousRank = values[i - 1] != values[i - 1] ? 1 : 0;
+            const int currentRank = values[i] != values[i] ? 1 : 0;
+            if (currentRank < previousRank || (previousRank == 0 && currentRank == 0 && values[i] < values[i - 1])) expected = false;
+        }
+        assert(isSorted(values) == expected);
+    }
+
+    const std::vector<std::string> sortedTexts = { "", "a", std::string("a\0", 2), std::string("a\0b", 3), "abcdefgh",
+        "abcdefgh", "abcdefghi", "abcdefghij", "abcdefgz", "b", "\x7f", "\xff" };
+    assert(isSorted(sortedTexts));
+    assert(std::is_sorted(sortedTexts.begin(), sortedTexts.end()));
+    for (size_t i = 1; i < sortedTexts.size(); ++i) {
+        std::vector<std::string> swapped = sortedTexts;
+        std::swap(swapped[i - 1], swapped[i]);
+        assert(isSorted(swapped) == std::is_sorted(swapped.begin(), swapped.end()));
+    }
+    assert(!isSorted(std::vector<std::string>{ "prefix-common-tail-b", "prefix-common-tail-a" }));
+    assert(!isSorted(std::vector<std::string>{ "abcdefghij", "abcdefghi" }));
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    const std::vector<std::string_view> views(sortedTexts.begin(), sortedTexts.end());
+    assert(isSorted(views));
+#endif
+
+    std::vector<std::vector<int64_t>> columns(3, std::vector<int64_t>(5000));
+    std::vector<std::vector<int64_t>> rows(5000, std::vector<int64_t>(3));
+    for (std::vector<int64_t>& row : rows) {
+        for (int64_t& key : row) key = static_cast<int64_t>(rng() % 3);
+    }
+    std::sort(rows.begin(), rows.end());
+    for (size_t r = 0; r < rows.size(); ++r) {
+        for (size_t c = 0; c < 3; ++c) columns[c][r] = rows[r][c];
+    }
+    assert(isSortedLexicographic(columns));
+    for (size_t r : { size_t(1), size_t(1023), size_t(1024), size_t(4999) }) {
+        for (size_t c = 0; c < 3; ++c) {
+            std::vector<std::vector<int64_t>> changed = columns;
+            std::vector<std::vector<int64_t>> changedRows = rows;
+            changed[c][r] = changedRows[r][c] = -1;
+            assert(isSortedLexicographic(changed) == std::is_sorted(changedRows.begin(), changedRows.end()));
+        }
+    }
+    assert(isSortedLexicographic({}));
+
+    try {
+        isSortedLexicographic({ { 1, 2 }, { 1 } });
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji isSorted terspesialisasi lulus!\n";
+}
+
+/// <summary>
+/// Satu kelas equivalence hasil <see cref="discoverBoundaries"/>: rentang tertutup masukan
+/// yang seluruhnya menghasilkan keluaran yang sama.
+/// </summary>
+struct EquivalenceClass {
+    int low;
+    int high;
+    int output; // keluaran predikat sebagai int (Status::Success = 0, Status::Failure = 1; bool 0/1)
+};
+
+/// <summary>
+/// Hasil penemuan batas: kelas equivalence, titik batas, vektor uji, dan jumlah evaluasi.
+/// </summary>
+struct BoundaryReport {
+    std::vector<EquivalenceClass> classes;
+    std::vector<int> boundaries;  // b dengan f(b - 1) != f(b), terurut naik
+    std::vector<int> testVectors; // nilai BVA: ujung tiap kelas, tetangganya, dan satu titik tengah
+    uint64_t evaluations;
+};
+
+/// <summary>
+/// 33) Menemukan semua titik perubahan keluaran predikat int -&gt; Status/bool secara otomatis
+/// (otomasi Boundary Value Analysis seperti pada bagian 2 dan 4).
+/// </summary>
+/// <param name="predicate">Fungsi murni int -&gt; Status atau bool; dipanggil dari banyak thread.</param>
+/// <param name="low">Batas bawah domain (inklusif).</param>
+/// <param name="high">Batas atas domain (inklusif).</param>
+/// <param name="samples">Jumlah titik sampel kasar berjarak sama (minimal 2); benih skala log ditambahkan.</param>
+/// <param name="threadCount">Jumlah thread; 0 berarti semua core.</param>
+/// <returns>Laporan kelas equivalence dan vektor uji.</returns>
+/// <exception cref="std::invalid_argument">Bila low &gt; high atau samples &lt; 2.</exception>
+/// <remarks>
+/// Tahap 1 mengevaluasi sampel berjarak sama dan benih skala log secara paralel. Tahap 2, untuk setiap pasangan
+/// sampel bertetangga dengan keluaran berbeda, mencari biner satu titik perubahan lalu
+/// berulang pada kedua sisinya selama ujung-ujungnya masih berbeda; interval diproses
+/// paralel. Totalnya O(samples + k log(range / samples)) evaluasi untuk k batas. Perubahan yang
+/// kembali ke keluaran semula di antara dua sampel (lebih sempit dari jarak sampel) tidak
+/// terlihat; perbanyak sampel bila predikat dapat memiliki "paku" sempit.
+/// </remarks>
+template <typename Predicate>
+BoundaryReport discoverBoundaries(Predicate&& predicate, int low = INT32_MIN, int high = INT32_MAX,
+    size_t samples = 1 << 16, unsigned threadCount = 0) {
+    if (low > high || samples < 2) {
+        throw std::invalid_argument("Domain atau jumlah sampel tidak valid");
+    }
+    const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(high) - low);
+    if (samples - 1 > span) samples = static_cast<size_t>(span) + 1;
+
+    std::atomic<uint64_t> evaluations(0);
+    auto evaluate = [&](int x) {
+        evaluations.fetch_add(1, std::memory_order_relaxed);
+        return static_cast<int>(predicate(x));
+    };
+
+    // Tahap 1: sampel kasar berjarak sama (titik ke-i = low + floor(i * span / (samples - 1)))
+    // ditambah benih skala log di sekitar nol (0, +-2^k, +-10^k), tempat batas buatan tangan
+    // biasanya berada, supaya kelas sempit seperti [1, 100] tidak terlewat jarak sampel.
+    std::vector<int> points;
+    for (size_t i = 0; i < samples; ++i) {
+        const uint64_t offset = static_cast<uint64_t>((static_cast<long double>(span) * i) / (samples - 1));
+        points.push_back(static_cast<int>(static_cast<int64_t>(low) + static_cast<int64_t>(std::min(offset, span))));
+    }
+    std::vector<int64_t> seeds = { 0 };
+    for (int64_t power = 1; power <= INT32_MAX; power *= 2) seeds.push_back(power);
+    for (int64_t power = 10; power <= INT32_MAX; power *= 10) seeds.push_back(power);
+    for (size_t i = 0, n = seeds.size(); i < n; ++i) seeds.push_back(-seeds[i]);
+    for (int64_t seed : seeds) {
+        if (seed >= low && seed <= high) points.push_back(static_cast<int>(seed));
+    }
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    samples = points.size();
+    std::vector<int> outputs(samples);
+    const size_t sampleChunks = (samples + 1023) / 1024;
+    parallelFor(sampleChunks, threadCount, [&](size_t c) {
+        for (size_t i = c * 1024; i < std::min(samples, (c + 1) * 1024); ++i) outputs[i] = evaluate(points[i]);
+    });
+
+    // Tahap 2: pencarian biner rekursif pada interval yang ujung-ujungnya berbeda.
+    std::vector<size_t> changed;
+    for (size_t i = 1; i < samples; ++i) {
+        if (outputs[i] != outputs[i - 1]) changed.push_back(i);
+    }
+    std::vector<std::vector<int>> found(changed.size());
+    parallelFor(changed.size(), threadCount, [&](size_t c) {
+        struct Interval { int lo, hi, outLo, outHi; };
+        const size_t i = changed[c];
+        std::vector<Interval> pending = { { points[i - 1], points[i], outputs[i - 1], outputs[i] } };
+        while (!pending.empty()) {
+            Interval interval = pending.back();
+            pending.pop_back();
+            // Invarian: f(lo) == outLo != outHi == f(hi).
+            int lo = interval.lo, hi = interval.hi, outLo = interval.outLo, outHi = interval.outHi;
+            while (static_cast<int64_t>(hi) - lo > 1) {
+                const int mid = static_cast<int>(lo + (static_cast<int64_t>(hi) - lo) / 2);
+                const int outMid = evaluate(mid);
+                if (outMid == outLo) {
+                    lo = mid;
+                }
+                else {
+                    // Sisi kanan [mid, hi] disimpan dengan ujung saat ini sebelum interval dipersempit.
+                    if (outMid != outHi) pending.push_back({ mid, hi, outMid, outHi });
+                    hi = mid;
+                    outHi = outMid;
+                }
+            }
+            found[c].push_back(hi);
+        }
+    });
+
+    BoundaryReport report;
+    for (const std::vector<int>& boundaries : found) {
+        report.boundaries.insert(report.boundaries.end(), boundaries.begin(), boundaries.end());
+    }
+    std::sort(report.boundaries.begin(), report.boundaries.end());
+
+    int classLow = low;
+    for (size_t b = 0; b <= report.boundaries.size(); ++b) {
+        const int classHigh = b < report.boundaries.size() ? report.boundaries[b] - 1 : high;
+        report.classes.push_back({ classLow, classHigh, evaluate(classLow) });
+        if (b < report.boundaries.size()) classLow = report.boundaries[b];
+    }
+    for (const EquivalenceClass& range : report.classes) {
+        report.testVectors.push_back(range.low);
+        if (range.low < range.high) report.testVectors.push_back(range.low + 1);
+        report.testVectors.push_back(static_cast<int>(range.low + (static_cast<int64_t>(range.high) - range.low) / 2));
+        if (range.low < range.high) report.testVectors.push_back(range.high - 1);
+        report.testVectors.push_back(range.high);
+    }
+    std::sort(report.testVectors.begin(), report.testVectors.end());
+    report.testVectors.erase(std::unique(report.testVectors.begin(), report.testVectors.end()), report.testVectors.end());
+    report.evaluations = evaluations.load();
+    return report;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="discoverBoundaries"/> pada predikat bagian 2, 4, dan 10.
+/// </summary>
+void testBoundaryDiscovery() {
+    const BoundaryReport process = discoverBoundaries(processValue, INT32_MIN, INT32_MAX, 1024, 4);
+    assert(process.boundaries == std::vector<int>{ 0 });
+    assert(process.classes.size() == 2);
+    assert(process.classes[0].low == INT32_MIN && process.classes[0].high == -1);
+    assert(process.classes[0].output == static_cast<int>(Status::Failure));
+    assert(process.classes[1].low == 0 && process.classes[1].high == INT32_MAX);
+    assert(process.evaluations < 1024 + 100 + 2 * 32 + 2);
+    for (int value : { -1, 0, 1, INT32_MIN, INT32_MAX }) {
+        assert(std::find(process.testVectors.begin(), process.testVectors.end(), value) != process.testVectors.end());
+    }
+
+    const BoundaryReport range = discoverBoundaries(checkRange, INT32_MIN, INT32_MAX, 4096);
+    assert((range.boundaries == std::vector<int>{ 1, 101 }));
+    assert(range.classes.size() == 3);
+    assert(range.classes[1].low == 1 && range.classes[1].high == 100);
+    assert(range.classes[1].output == static_cast<int>(Status::Success));
+    for (int value : { 0, 1, 2, 99, 100, 101 }) {
+        assert(std::find(range.testVectors.begin(), range.testVectors.end(), value) != range.testVectors.end());
+        assert(checkRange(value) == ((value >= 1 && value <= 100) ? Status::Success : Status::Failure));
+    }
+
+    // Banyak batas dalam satu interval sampel dengan keluaran berbeda-beda: rekursi menemukan semuanya.
+    auto steps = [](int x) { return x < 1100 ? 0 : x < 1500 ? 1 : x < 1501 ? 2 : 3; };
+    const BoundaryReport stepped = discoverBoundaries(steps, 1001, 1999, 2, 1);
+    assert((stepped.boundaries == std::vector<int>{ 1100, 1500, 1501 }));
+    assert(stepped.classes.size() == 4 && stepped.classes[2].low == 1500 && stepped.classes[2].high == 1500);
+    assert(stepped.classes[3].output == 3);
+
+    // Fuzz: fungsi tangga naik dengan keluaran berbeda-beda dan beberapa batas di dalam satu
+    // interval sampel, dibandingkan dengan penyapuan penuh.
+    Xoshiro256StarStar rng(73);
+    for (int trial = 0; trial < 500; ++trial) {
+        std::vector<int> cuts;
+        for (size_t k = 1 + rng() % 6; k != 0; --k) cuts.push_back(1001 + static_cast<int>(rng() % 999));
+        std::sort(cuts.begin(), cuts.end());
+        cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+        auto ladder = [&cuts](int x) { return static_cast<int>(std::upper_bound(cuts.begin(), cuts.end(), x) - cuts.begin()); };
+        const BoundaryReport report = discoverBoundaries(ladder, 1000, 1999, 2, 1);
+        std::vector<int> brute;
+        for (int x = 1001; x <= 1999; ++x) {
+            if (ladder(x) != ladder(x - 1)) brute.push_back(x);
+        }
+        assert(report.boundaries == brute);
+        assert(std::adjacent_find(report.boundaries.begin(), report.boundaries.end()) == report.boundaries.end());
+        assert(report.classes.size() == brute.size() + 1);
+        for (const EquivalenceClass& equivalence : report.classes) {
+            assert(equivalence.low <= equivalence.high && equivalence.output == ladder(equivalence.low) &&
+                equivalence.output == ladder(equivalence.high));
+        }
+    }
+
+    // Sampel sebanyak domain menyamai penyapuan penuh: semua batas isPrime di [0, 100].
+    const BoundaryReport primes = discoverBoundaries(isPrime, 0, 100, 101);
+    std::vector<int> expected;
+    for (int x = 1; x <= 100; ++x) {
+        if (isPrime(x) != isPrime(x - 1)) expected.push_back(x);
+    }
+    assert(primes.boundaries == expected);
+
+    const BoundaryReport single = discoverBoundaries(processValue, 7, 7, 10);
+    assert(single.classes.size() == 1 && single.testVectors == std::vector<int>{ 7 });
+
+    try {
+        discoverBoundaries(processValue, 5, 4);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    std::cout << "Semua uji penemuan batas lulus!\n";
+}
+
+/// <summary>
+/// 34) Sapuan kombinasi dua parameter. Keluaran predikat diubah menjadi bit:
+/// Status::Success atau true bernilai 1.
+/// </summary>
+inline bool combinationPassed(Status status) { return status == Status::Success; }
+inline bool combinationPassed(bool value) { return value; }
+
+/// <summary>Ukuran ubin sapuan kombinasi: 64 baris x 64 kata (4096 kolom).</summary>
+const size_t kCombinationTileRows = 64;
+const size_t kCombinationTileWords = 64;
+
+/// <summary>
+/// Menghitung satu kata bitmap: bit j = f(a, domainB[column + j]) untuk j &lt; count.
+/// </summary>
+/// <remarks>Menerima vektor (bukan penunjuk) agar std::vector&lt;bool&gt; juga dapat menjadi domain.</remarks>
+template <typename A, typename B, typename Function>
+inline uint64_t evaluateCombinationWord(const A& a, const std::vector<B>& domainB, size_t column, size_t count,
+    Function& function) {
+    uint64_t word = 0;
+    for (size_t j = 0; j < count; ++j) {
+        word |= static_cast<uint64_t>(combinationPassed(function(a, domainB[column + j])) ? 1 : 0) << j;
+    }
+    return word;
+}
+
+/// <summary>
+/// Memanggil visit(row, wordIndex, rowBegin, wordCount) untuk setiap ubin 64 x 4096 dari
+/// hasil kali Kartesius, tersebar ke beberapa thread.
+/// </summary>
+template <typename Visit>
+void forEachCombinationTile(size_t rows, size_t columns, unsigned threadCount, Visit&& visit) {
+    const size_t words = (columns + 63) / 64;
+    const size_t rowTiles = (rows + kCombinationTileRows - 1) / kCombinationTileRows;
+    const size_t wordTiles = (words + kCombinationTileWords - 1) / kCombinationTileWords;
+    parallelFor(rowTiles * wordTiles, threadCount, [&](size_t tile) {
+        const size_t rowBegin = (tile / wordTiles) * kCombinationTileRows;
+        const size_t wordBegin = (tile % wordTiles) * kCombinationTileWords;
+        visit(rowBegin, std::min(rows, rowBegin + kCombinationTileRows),
+            wordBegin, std::min(words, wordBegin + kCombinationTileWords));
+    });
+}
+
+/// <summary>
+/// Matriks hasil sapuan kombinasi dua parameter sebagai bitmap baris-mayor
+/// (satu bit per pasangan).
+/// </summary>
+class CombinationBitmap {
+public:
+    CombinationBitmap(size_t rows, size_t columns)
+        : m_rows(rows), m_columns(columns), m_stride((columns + 63) / 64), m_words(rows * m_stride, 0) {}
+
+    size_t rows() const { return m_rows; }
+    size_t columns() const { return m_columns; }
+
+    bool test(size_t row, size_t column) const {
+        return (m_words[row * m_stride + column / 64] >> (column % 64)) & 1;
+    }
+
+    /// <summary>Jumlah pasangan yang lolos.</summary>
+    uint64_t count() const {
+        uint64_t total = 0;
+        for (uint64_t word : m_words) total += popcount64(word);
+        return total;
+    }
+
+    /// <summary>Kata ke-<paramref name="word"/> dari baris <paramref name="row"/>.</summary>
+    uint64_t& word(size_t row, size_t word) { return m_words[row * m_stride + word]; }
+    uint64_t word(size_t row, size_t word) const { return m_words[row * m_stride + word]; }
+
+private:
+    size_t m_rows;
+    size_t m_columns;
+    size_t m_stride;
+    std::vector<uint64_t> m_words;
+};
+
+/// <summary>
+/// Mengevaluasi <paramref name="function"/>(a, b) untuk seluruh hasil kali Kartesius kedua
+/// domain dan menyimpan hasilnya sebagai bitmap.
+/// </summary>
+/// <param name="domainA">Domain parameter pertama (baris). Untuk n parameter, gunakan domain tuple.</param>
+/// <param name="domainB">Domain parameter kedua (kolom).</param>
+/// <param name="function">Fungsi (a, b) -&gt; Status atau bool; dipanggil dari banyak thread.</param>
+/// <param name="threadCount">Jumlah thread; 0 berarti semua core.</param>
+/// <remarks>
+/// Ubin 64 baris x 4096 kolom menjaga potongan domainB tetap di L1 selama 64 baris. Bitmap
+/// berukuran |A| |B| / 8 byte; untuk domain 10^5 x 10^5 (1,25 GB) gunakan
+/// <see cref="diffCombinations"/> yang tidak menyimpan matriks.
+/// </remarks>
+template <typename A, typename B, typename Function>
+CombinationBitmap sweepCombinations(const std::vector<A>& domainA, const std::vector<B>& domainB,
+    Function&& function, unsigned threadCount = 0) {
+    CombinationBitmap bitmap(domainA.size(), domainB.size());
+    forEachCombinationTile(domainA.size(), domainB.size(), threadCount,
+        [&](size_t rowBegin, size_t rowEnd, size_t wordBegin, size_t wordEnd) {
+            for (size_t r = rowBegin; r < rowEnd; ++r) {
+                for (size_t w = wordBegin; w < wordEnd; ++w) {
+                    const size_t column = w * 64;
+                    bitmap.word(r, w) = evaluateCombinationWord(domainA[r], domainB, column,
+                        std::min<size_t>(64, domainB.size() - column), function);
+                }
+            }
+        });
+    return bitmap;
+}
+
+/// <summary>
+/// Hasil perbandingan sapuan dengan aturan yang diharapkan.
+/// </summary>
+struct CombinationDiff {
+    uint64_t evaluated;                                // jumlah pasangan
+    uint64_t mismatches;                               // pasangan yang berbeda dari aturan
+    std::vector<std::pair<size_t, size_t>> examples;   // (indeks a, indeks b) pertama yang berbeda, terurut
+};
+
+/// <summary>
+/// Membandingkan <paramref name="function"/> dengan <paramref name="rule"/> di seluruh hasil
+/// kali Kartesius secara streaming: tiap ubin menghasilkan kata bitmap keduanya, di-XOR, dan
+/// dihitung dengan popcount, tanpa menyimpan matriks.
+/// </summary>
+/// <param name="maxExamples">Jumlah contoh ketidakcocokan yang dilaporkan.</param>
+/// <remarks>
+/// Dalam satu ubin pasangan dikunjungi berurutan naik, jadi setiap ubin cukup menyimpan
+/// maxExamples kandidat pertamanya lalu berhenti mengumpulkan; kandidat per ubin digabung
+/// dan dipangkas sekali setelah sapuan selesai.
+/// </remarks>
+template <typename A, typename B, typename Function, typename Rule>
+CombinationDiff diffCombinations(const std::vector<A>& domainA, const std::vector<B>& domainB,
+    Function&& function, Rule&& rule, unsigned threadCount = 0, size_t maxExamples = 16) {
+    std::atomic<uint64_t> mismatches(0);
+    std::mutex examplesMutex;
+    CombinationDiff diff;
+    diff.evaluated = static_cast<uint64_t>(domainA.size()) * domainB.size();
+    forEachCombinationTile(domainA.size(), domainB.size(), threadCount,
+        [&](size_t rowBegin, size_t rowEnd, size_t wordBegin, size_t wordEnd) {
+            uint64_t local = 0;
+            std::vector<std::pair<size_t, size_t>> localExamples;
+            for (size_t r = rowBegin; r < rowEnd; ++r) {
+                for (size_t w = wordBegin; w < wordEnd; ++w) {
+                    const size_t column = w * 64;
+                    const size_t count = std::min<size_t>(64, domainB.size() - column);
+                    const uint64_t different = evaluateCombinationWord(domainA[r], domainB, column, count, function) ^
+                        evaluateCombinationWord(domainA[r], domainB, column, count, rule);
+                    if (different == 0) continue;
+                    local += popcount64(different);
+                    for (uint64_t bits = different; bits != 0 && localExamples.size() < maxExamples; bits &= bits - 1) {
+                        localExamples.emplace_back(r, column + countTrailingZeros64(bits));
+                    }
+                }
+            }
+            mismatches += local;
+            if (!localExamples.empty()) {
+                std::lock_guard<std::mutex> lock(examplesMutex);
+                diff.examples.insert(diff.examples.end(), localExamples.begin(), localExamples.end());
+            }
+        });
+    // Simpan hanya contoh terkecil agar hasil tidak bergantung pada penjadwalan.
+    const size_t kept = std::min(maxExamples, diff.examples.size());
+    std::partial_sort(diff.examples.begin(), diff.examples.begin() + static_cast<ptrdiff_t>(kept), diff.examples.end());
+    diff.examples.resize(kept);
+    diff.mismatches = mismatches.load();
+    return diff;
+}
+
+/// <summary>
+/// Kumpulan uji untuk sapuan kombinasi dua parameter.
+/// </summary>
+void testCombinationSweep() {
+    // Seluruh domain evaluateCombination ditambah nilai di luar [0, 10].
+    std::vector<int> domainA;
+    for (int a = -5; a <= 15; ++a) domainA.push_back(a);
+    const std::vector<bool> domainB = { false, true };
+    const CombinationBitmap bitmap = sweepCombinations(domainA, domainB, evaluateCombination, 2);
+    assert(bitmap.count() == 11);
+    for (size_t r = 0; r < domainA.size(); ++r) {
+        for (size_t c = 0; c < domainB.size(); ++c) {
+            assert(bitmap.test(r, c) == (evaluateCombination(domainA[r], domainB[c]) == Status::Success));
+        }
+    }
+    auto rule = [](int a, bool b) { return a >= 0 && a <= 10 && ((a % 2 == 0) == b); };
+    const CombinationDiff exact = diffCombinations(domainA, domainB, evaluateCombination, rule, 4);
+    assert(exact.evaluated == 42 && exact.mismatches == 0 && exact.examples.empty());
+
+    // Aturan yang salah di a == 10 (hanya kolom b == true yang berbeda).
+    auto wrongRule = [](int a, bool b) { return a >= 0 && a < 10 && ((a % 2 == 0) == b); };
+    const CombinationDiff wrong = diffCombinations(domainA, domainB, evaluateCombination, wrongRule, 4);
+    assert(wrong.mismatches == 1);
+    assert(wrong.examples.size() == 1 && domainA[wrong.examples[0].first] == 10 && wrong.examples[0].second == 1);
+
+    // Domain lebih besar yang melintasi beberapa ubin dan ujung kata parsial.
+    std::vector<int> rows(3000), columns(5000);
+    for (size_t i = 0; i < rows.size(); ++i) rows[i] = static_cast<int>(i) - 1000;
+    for (size_t i = 0; i < columns.size(); ++i) columns[i] = static_cast<int>(3 * i);
+    auto divisible = [](int a, int b) { return (a + b) % 7 == 0; };
+    const CombinationBitmap large = sweepCombinations(rows, columns, divisible, 8);
+    uint64_t expected = 0;
+    for (int a : rows) {
+        for (int b : columns) expected += divisible(a, b) ? 1 : 0;
+    }
+    assert(large.count() == expected);
+    const CombinationDiff largeDiff = diffCombinations(rows, columns, divisible,
+        [](int a, int b) { return (a + b) % 7 == 0 && a != 1234; }, 8, 4);
+    uint64_t expectedMismatches = 0;
+    for (int b : columns) expectedMismatches += divisible(1234, b) ? 1 : 0;
+    assert(largeDiff.mismatches == expectedMismatches && largeDiff.examples.size() == 4);
+    assert(rows[largeDiff.examples[0].first] == 1234);
+    assert(divisible(1234, columns[largeDiff.examples[0].second]));
+
+    // Aturan yang salah di semua pasangan: contoh tetap pasangan terkecil secara leksikografis.
+    const CombinationDiff inverted = diffCombinations(rows, columns, divisible,
+        [](int a, int b) { return (a + b) % 7 != 0; }, 8);
+    assert(inverted.mismatches == inverted.evaluated && inverted.examples.size() == 16);
+    for (size_t k = 0; k < 16; ++k) assert(inverted.examples[k] == std::make_pair(size_t(0), k));
+
+    std::cout << "Semua uji sapuan kombinasi lulus!\n";
+}
+
+/// <summary>
+/// 35) Bitmap terkompresi bergaya roaring untuk himpunan bilangan 32-bit tak bertanda.
+/// </summary>
+/// <remarks>
+/// Nilai dikelompokkan menurut 16 bit atas; tiap kelompok (64 Ki nilai) disimpan dalam
+/// kontainer yang paling hemat: array terurut (&lt;= 4096 nilai, 2 byte per nilai), bitmap
+/// 1024 kata (8 KiB), atau run (awal, panjang - 1), 4 byte per run. Operasi himpunan bekerja
+/// per kontainer: array x array memakai kernel merge terurut, kombinasi lain lewat kata
+/// bitmap dengan loop SSE2, lalu hasilnya dipilih ulang ke bentuk terkecil.
+/// </remarks>
+class RoaringBitmap {
+public:
+    /// <summary>Jenis kontainer.</summary>
+    enum class ContainerKind : uint8_t { Array, Bitmap, Run };
+
+    /// <summary>Menambahkan nilai.</summary>
+    /// <remarks>
+    /// Array yang penuh (4096 nilai) dipromosikan sekali ke bitmap, dan run diubah ke bitmap
+    /// pada penambahan pertamanya; penambahan ke bitmap cukup menyalakan satu bit. Bentuk
+    /// terkecil dipilih ulang oleh <see cref="optimize"/>, bukan pada setiap penambahan.
+    /// </remarks>
+    void add(uint32_t value) {
+        const uint16_t key = static_cast<uint16_t>(value >> 16), low = static_cast<uint16_t>(value);
+        const auto position = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+        const size_t index = static_cast<size_t>(position - m_keys.begin());
+        if (position == m_keys.end() || *position != key) {
+            m_keys.insert(position, key);
+            Container container;
+            container.kind = ContainerKind::Array;
+            container.cardinality = 1;
+            container.values.push_back(low);
+            m_containers.insert(m_containers.begin() + static_cast<ptrdiff_t>(index), std::move(container));
+            return;
+        }
+        Container& container = m_containers[index];
+        if (container.kind == ContainerKind::Bitmap) {
+            uint64_t& word = container.words[low / 64];
+            const uint64_t bit = 1ull << (low % 64);
+            container.cardinality += (word & bit) == 0 ? 1 : 0;
+            word |= bit;
+            return;
+        }
+        if (container.kind == ContainerKind::Array) {
+            const auto slot = std::lower_bound(container.values.begin(), container.values.end(), low);
+            if (slot != container.values.end() && *slot == low) return;
+            if (container.cardinality < kArrayLimit) {
+                container.values.insert(slot, low);
+                ++container.cardinality;
+                return;
+            }
+        }
+        else if (contains(container, low)) {
+            return;
+        }
+        Container promoted;
+        promoted.kind = ContainerKind::Bitmap;
+        promoted.cardinality = container.cardinality + 1;
+        promoted.words.resize(kWords);
+        toWords(container, promoted.words.data());
+        promoted.words[low / 64] |= 1ull << (low % 64);
+        container = std::move(promoted);
+    }
+
+    /// <summary>True bila <paramref name="value"/> anggota himpunan.</summary>
+    bool contains(uint32_t value) const {
+        const uint16_t key = static_cast<uint16_t>(value >> 16);
+        const auto position = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+        if (position == m_keys.end() || *position != key) return false;
+        return contains(m_containers[static_cast<size_t>(position - m_keys.begin())], static_cast<uint16_t>(value));
+    }
+
+    /// <summary>Jumlah anggota.</summary>
+    uint64_t cardinality() const {
+        uint64_t total = 0;
+        for (const Container& container : m_containers) total += container.cardinality;
+        return total;
+    }
+
+    /// <summary>Jumlah kontainer.</summary>
+    size_t containerCount() const { return m_containers.size(); }
+
+    /// <summary>Jenis kontainer ke-<paramref name="index"/> (urut kunci).</summary>
+    ContainerKind containerKind(size_t index) const { return m_containers[index].kind; }
+
+    /// <summary>Perkiraan memori payload kontainer dalam byte.</summary>
+    size_t sizeInBytes() const {
+        size_t total = m_keys.size() * sizeof(uint16_t);
+        for (const Container& container : m_containers) {
+            total += container.values.size() * sizeof(uint16_t) + container.words.size() * sizeof(uint64_t);
+        }
+        return total;
+    }
+
+    /// <summary>Semua anggota, terurut naik.</summary>
+    std::vector<uint32_t> toVector() const {
+        std::vector<uint32_t> result;
+        result.reserve(static_cast<size_t>(cardinality()));
+        std::vector<uint64_t> words(kWords);
+        for (size_t c = 0; c < m_containers.size(); ++c) {
+            const uint32_t high = static_cast<uint32_t>(m_keys[c]) << 16;
+            toWords(m_containers[c], words.data());
+            for (size_t w = 0; w < kWords; ++w) {
+                for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1) {
+                    result.push_back(high | static_cast<uint32_t>(w * 64 + countTrailingZeros64(bits)));
+                }
+            }
+        }
+        return result;
+    }
+
+    /// <summary>Memilih ulang bentuk terkecil untuk setiap kontainer (misalnya setelah banyak add).</summary>
+    void optimize() {
+        std::vector<uint64_t> words(kWords);
+        for (Container& container : m_containers) {
+            toWords(container, words.data());
+            container = fromWords(words.data());
+        }
+    }
+
+    /// <summary>Irisan.</summary>
+    friend RoaringBitmap operator&(const RoaringBitmap& a, const RoaringBitmap& b) {
+        RoaringBitmap result;
+        size_t i = 0, j = 0;
+        while (i < a.m_keys.size() && j < b.m_keys.size()) {
+            if (a.m_keys[i] < b.m_keys[j]) {
+                ++i;
+            }
+            else if (b.m_keys[j] < a.m_keys[i]) {
+                ++j;
+            }
+            else {
+                Container container = combine(a.m_containers[i], b.m_containers[j], false);
+                if (container.cardinality != 0) result.append(a.m_keys[i], std::move(container));
+                ++i;
+                ++j;
+            }
+        }
+        return result;
+    }
+
+    /// <summary>Gabungan.</summary>
+    friend RoaringBitmap operator|(const RoaringBitmap& a, const RoaringBitmap& b) {
+        RoaringBitmap result;
+        size_t i = 0, j = 0;
+        while (i < a.m_keys.size() || j < b.m_keys.size()) {
+            if (j == b.m_keys.size() || (i < a.m_keys.size() && a.m_keys[i] < b.m_keys[j])) {
+                result.append(a.m_keys[i], a.m_containers[i]);
+                ++i;
+            }
+            else if (i == a.m_keys.size() || b.m_keys[j] < a.m_keys[i]) {
+                result.append(b.m_keys[j], b.m_containers[j]);
+                ++j;
+            }
+            else {
+                result.append(a.m_keys[i], combine(a.m_containers[i], b.m_containers[j], true));
+                ++i;
+                ++j;
+            }
+        }
+        return result;
+    }
+
+    friend bool operator==(const RoaringBitmap& a, const RoaringBitmap& b) { return a.toVector() == b.toVector(); }
+
+    /// <summary>
+    /// Menulis ke stream: magic, jumlah kontainer, lalu per kontainer kunci (2 byte), jenis
+    /// (1 byte), kardinalitas (4 byte), dan payload (nilai 2 byte atau kata 8 byte), semua
+    /// little-endian.
+    /// </summary>
+    void write(std::ostream& out) const {
+        writeLittleEndian(out, kMagic, 4);
+        writeLittleEndian(out, m_containers.size(), 4);
+        for (size_t c = 0; c < m_containers.size(); ++c) {
+            const Container& container = m_containers[c];
+            writeLittleEndian(out, m_keys[c], 2);
+            writeLittleEndian(out, static_cast<uint64_t>(container.kind), 1);
+            writeLittleEndian(out, container.cardinality, 4);
+            if (container.kind == ContainerKind::Bitmap) {
+                for (uint64_t word : container.words) writeLittleEndian(out, word, 8);
+            }
+            else {
+                writeLittleEndian(out, container.values.size(), 4);
+                for (uint16_t value : container.values) writeLittleEndian(out, value, 2);
+            }
+        }
+        if (!out) {
+            throw std::runtime_error("Gagal menulis bitmap");
+        }
+    }
+
+    /// <summary>Membaca bitmap yang ditulis oleh <see cref="write"/>.</summary>
+    /// <exception cref="std::invalid_argument">
+    /// Bila format tidak valid, stream terpotong, atau payload kontainer tidak konsisten
+    /// (array tidak naik tegas, run tumpang tindih atau melewati 65535, kardinalitas tidak cocok).
+    /// </exception>
+    static RoaringBitmap read(std::istream& in) {
+        RoaringBitmap result;
+        uint64_t magic = 0, count = 0;
+        if (!readLittleEndian(in, magic, 4) || magic != kMagic || !readLittleEndian(in, count, 4) || count > 65536) {
+            throw std::invalid_argument("Header bitmap tidak valid");
+        }
+        for (uint64_t c = 0; c < count; ++c) {
+            uint64_t key = 0, kind = 0, cardinality = 0, size = 0;
+            if (!readLittleEndian(in, key, 2) || !readLittleEndian(in, kind, 1) || !readLittleEndian(in, cardinality, 4) ||
+                kind > 2 || cardinality == 0 || cardinality > 65536 ||
+                (!result.m_keys.empty() && key <= result.m_keys.back())) {
+                throw std::invalid_argument("Kontainer bitmap tidak valid");
+            }
+            Container container;
+            container.kind = static_cast<ContainerKind>(kind);
+            container.cardinality = static_cast<uint32_t>(cardinality);
+            if (container.kind == ContainerKind::Bitmap) {
+                container.words.resize(kWords);
+                for (uint64_t& word : container.words) {
+                    if (!readLittleEndian(in, word, 8)) throw std::invalid_argument("Bitmap terpotong");
+                }
+            }
+            else {
+                if (!readLittleEndian(in, size, 4) || size > 65536) throw std::invalid_argument("Kontainer bitmap tidak valid");
+                container.values.resize(static_cast<size_t>(size));
+                for (uint16_t& value : container.values) {
+                    uint64_t raw = 0;
+                    if (!readLittleEndian(in, raw, 2)) throw std::invalid_argument("Bitmap terpotong");
+                    value = static_cast<uint16_t>(raw);
+                }
+            }
+            if (!isValid(container)) {
+                throw std::invalid_argument("Payload kontainer bitmap tidak valid");
+            }
+            result.append(static_cast<uint16_t>(key), std::move(container));
+        }
+        return result;
+    }
+
+    /// <summary>
+    /// Membangun bitmap dari kata bitmap 65536 bit untuk kunci <paramref name="key"/>
+    /// (dipakai produsen batch; kunci harus ditambahkan berurutan naik).
+    /// </summary>
+    void appendWords(uint16_t key, const uint64_t* words) {
+        Container container = fromWords(words);
+        if (container.cardinality != 0) append(key, std::move(container));
+    }
+
+    /// <summary>
+    /// Memindahkan semua kontainer <paramref name="tail"/> ke ujung bitmap ini; semua kuncinya
+    /// harus lebih besar dari kunci terakhir di sini (dipakai untuk menyambung hasil per blok).
+    /// </summary>
+    /// <exception cref="std::invalid_argument">Bila kunci tidak berurutan naik.</exception>
+    void append(RoaringBitmap&& tail) {
+        if (!tail.m_keys.empty() && !m_keys.empty() && tail.m_keys.front() <= m_keys.back()) {
+            throw std::invalid_argument("Kunci bitmap harus naik");
+        }
+        for (size_t c = 0; c < tail.m_keys.size(); ++c) append(tail.m_keys[c], std::move(tail.m_containers[c]));
+        tail.m_keys.clear();
+        tail.m_containers.clear();
+    }
+
+private:
+    static const uint32_t kArrayLimit = 4096;
+    static const size_t kWords = 1024;
+    static const uint64_t kMagic = 0x474E5252; // "RRNG"
+
+    struct Container {
+        ContainerKind kind;
+        uint32_t cardinality;
+        std::vector<uint16_t> values; // Array: nilai terurut; Run: pasangan (awal, panjang - 1)
+        std::vector<uint64_t> words;  // Bitmap: 1024 kata
+    };
+
+    void append(uint16_t key, Container container) {
+        m_keys.push_back(key);
+        m_containers.push_back(std::move(container));
+    }
+
+    static bool isValid(const Container& container) {
+        uint64_t cardinality = 0;
+        switch (container.kind) {
+        case ContainerKind::Array:
+            for (size_t i = 1; i < container.values.size(); ++i) {
+                if (container.values[i - 1] >= container.values[i]) return false;
+            }
+            cardinality = container.values.size();
+            return cardinality == container.cardinality && cardinality <= kArrayLimit;
+        case ContainerKind::Bitmap:
+            for (uint64_t word : container.words) cardinality += popcount64(word);
+            return cardinality == container.cardinality;
+        default: {
+            if (container.values.size() % 2 != 0) return false;
+            int64_t previousEnd = -1;
+            for (size_t r = 0; r < container.values.size(); r += 2) {
+                const int64_t first = container.values[r], last = first + container.values[r + 1];
+                if (first <= previousEnd || last > 65535) return false;
+                cardinality += static_cast<uint64_t>(last - first + 1);
+                previousEnd = last;
+            }
+            return cardinality == container.cardinality;
+        }
+        }
+    }
+
+    static bool contains(const Container& container, uint16_t low) {
+        switch (container.kind) {
+        case ContainerKind::Array:
+            return std::binary_search(container.values.begin(), container.values.end(), low);
+        case ContainerKind::Bitmap:
+            return (container.words[low / 64] >> (low % 64)) & 1;
+        default:
+            for (size_t r = 0; r < container.values.size(); r += 2) {
+                if (low < container.values[r]) return false;
+                if (low - container.values[r] <= container.values[r + 1]) return true;
+            }
+            return false;
+        }
+    }
+
+    static void toWords(const Container& container, uint64_t* words) {
+        if (container.kind == ContainerKind::Bitmap) {
+            std::copy(container.words.begin(), container.words.end(), words);
+            return;
+        }
+        std::fill(words, words + kWords, 0);
+        if (container.kind == ContainerKind::Array) {
+            for (uint16_t value : container.values) words[value / 64] |= 1ull << (value % 64);
+            return;
+        }
+        for (size_t r = 0; r < container.values.size(); r += 2) {
+            const uint32_t first = container.values[r], last = first + container.values[r + 1];
+            for (uint32_t w = first / 64; w <= last / 64; ++w) {
+                const uint32_t from = std::max(first, w * 64) - w * 64, to = std::min(last, w * 64 + 63) - w * 64;
+                words[w] |= (to == 63 ? ~0ull : ((1ull << (to + 1)) - 1)) & ~((1ull << from) - 1);
+            }
+        }
+    }
+
+    /// <summary>Memilih bentuk terkecil dari array, bitmap, dan run untuk kata-kata ini.</summary>
+    static Container fromWords(const uint64_t* words) {
+        Container container;
+        uint32_t cardinality = 0, runs = 0;
+        uint64_t previousTop = 0;
+        for (size_t w = 0; w < kWords; ++w) {
+            const uint64_t word = words[w];
+            cardinality += popcount64(word);
+            // Awal run: bit 1 yang bit sebelumnya 0.
+            runs += popcount64(word & ~((word << 1) | previousTop));
+            previousTop = word >> 63;
+        }
+        container.cardinality = cardinality;
+        const size_t arrayBytes = 2 * static_cast<size_t>(cardinality), runBytes = 4 * static_cast<size_t>(runs);
+        if (runBytes < std::min<size_t>(arrayBytes, 8192)) {
+            container.kind = ContainerKind::Run;
+            for (uint32_t bit = 0; bit < 65536;) {
+                const uint64_t word = words[bit / 64] >> (bit % 64);
+                if (word == 0) {
+                    bit = (bit / 64 + 1) * 64;
+                    continue;
+                }
+                const uint32_t start = bit + countTrailingZeros64(word);
+                uint32_t end = start;
+                while (end + 1 < 65536 && ((words[(end + 1) / 64] >> ((end + 1) % 64)) & 1)) ++end;
+                container.values.push_back(static_cast<uint16_t>(start));
+                container.values.push_back(static_cast<uint16_t>(end - start));
+                bit = end + 1;
+            }
+        }
+        else if (cardinality <= kArrayLimit) {
+            container.kind = ContainerKind::Array;
+            container.values.reserve(cardinality);
+            for (size_t w = 0; w < kWords; ++w) {
+                for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1) {
+                    container.values.push_back(static_cast<uint16_t>(w * 64 + countTrailingZeros64(bits)));
+                }
+            }
+        }
+        else {
+            container.kind = ContainerKind::Bitmap;
+            container.words.assign(words, words + kWords);
+        }
+        return container;
+    }
+
+    /// <summary>
+    /// Irisan (union = false) atau gabungan (union = true) dua kontainer. Array x array memakai
+    /// kernel merge terurut; selain itu lewat kata bitmap dengan AND/OR SSE2.
+    /// </summary>
+    static Container combine(const Container& a, const Container& b, bool unite) {
+        if (a.kind == ContainerKind::Array && b.kind == ContainerKind::Array &&
+            (!unite || a.cardinality + b.cardinality <= kArrayLimit)) {
+            Container result;
+            result.kind = ContainerKind::Array;
+            result.values.resize(unite ? a.values.size() + b.values.size() : std::min(a.values.size(), b.values.size()));
+            const size_t size = unite
+                ? dedupSortedScalar(result.values.data(), mergeSortedScalar(a.values.data(), a.values.size(), b.values.data(),
+                    b.values.size(), result.values.data()))
+                : intersectSortedScalar(a.values.data(), a.values.size(), b.values.data(), b.values.size(), result.values.data());
+            result.values.resize(size);
+            result.cardinality = static_cast<uint32_t>(size);
+            return result;
+        }
+        std::vector<uint64_t> left(kWords), right(kWords);
+        toWords(a, left.data());
+        toWords(b, right.data());
+        size_t w = 0;
+#if defined(IPPL_HAVE_SSE2)
+        for (; w + 2 <= kWords; w += 2) {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left.data() + w));
+            const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right.data() + w));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(left.data() + w), unite ? _mm_or_si128(x, y) : _mm_and_si128(x, y));
+        }
+#endif
+        for (; w < kWords; ++w) left[w] = unite ? (left[w] | right[w]) : (left[w] & right[w]);
+        return fromWords(left.data());
+    }
+
+    static void writeLittleEndian(std::ostream& out, uint64_t value, int bytes) {
+        char buffer[8];
+        for (int i = 0; i < bytes; ++i) buffer[i] = static_cast<char>(value >> (8 * i));
+        out.write(buffer, bytes);
+    }
+
+    static bool readLittleEndian(std::istream& in, uint64_t& value, int bytes) {
+        unsigned char buffer[8];
+        if (!in.read(reinterpret_cast<char*>(buffer), bytes)) return false;
+        value = 0;
+        for (int i = 0; i < bytes; ++i) value |= static_cast<uint64_t>(buffer[i]) << (8 * i);
+        return true;
+    }
+
+    std::vector<uint16_t> m_keys;
+    std::vector<Container> m_containers;
+};
+
+/// <summary>
+/// Produsen batch: himpunan offset i = x - low untuk x di [low, high] yang lolos predikat
+/// (int -&gt; Status/bool, seperti isPrime, checkRange, processValue), sebagai bitmap roaring.
+/// </summary>
+/// <param name="threadCount">Jumlah thread; tiap blok 64 Ki nilai dievaluasi satu tugas.</param>
+/// <exception cref="std::invalid_argument">Bila low &gt; high.</exception>
+/// <remarks>
+/// Setiap tugas mengisi 8 KiB kata bitmap sementara lalu langsung memadatkannya, sehingga
+/// hanya kontainer terkompresi yang disimpan per blok; memori puncak sebanding dengan ukuran
+/// hasil ditambah satu buffer per thread, bukan dengan lebar rentang.
+/// </remarks>
+template <typename Predicate>
+RoaringBitmap selectWhere(int low, int high, Predicate&& predicate, unsigned threadCount = 0) {
+    if (low > high) {
+        throw std::invalid_argument("Rentang tidak valid");
+    }
+    const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(high) - low) + 1;
+    const size_t chunks = static_cast<size_t>((span + 65535) / 65536);
+    std::vector<RoaringBitmap> parts(chunks);
+    parallelFor(chunks, threadCount, [&](size_t c) {
+        std::vector<uint64_t> words(1024, 0);
+        const uint64_t begin = static_cast<uint64_t>(c) * 65536;
+        const uint64_t end = std::min<uint64_t>(span, begin + 65536);
+        for (uint64_t offset = begin; offset < end; ++offset) {
+            const int x = static_cast<int>(static_cast<int64_t>(low) + static_cast<int64_t>(offset));
+            const uint64_t bit = combinationPassed(predicate(x)) ? 1 : 0;
+            words[(offset - begin) / 64] |= bit << (offset % 64);
+        }
+        parts[c].appendWords(static_cast<uint16_t>(c), words.data());
+    });
+    RoaringBitmap result;
+    for (RoaringBitmap& part : parts) result.append(std::move(part));
+    return result;
+}
+
+/// <summary>
+/// Kumpulan uji untuk <see cref="RoaringBitmap"/> dan <see cref="selectWhere"/>.
+/// </summary>
+void testRoaringBitmap() {
+    Xoshiro256StarStar rng(75);
+    std::vector<uint32_t> sparse, dense, runs;
+    for (int i = 0; i < 3000; ++i) sparse.push_back(static_cast<uint32_t>(rng()));
+    for (int i = 0; i < 40000; ++i) dense.push_back((3u << 16) | static_cast<uint32_t>(rng() % 65536));
+    for (uint32_t v = 100000; v < 300000; ++v) runs.push_back(v);
+    for (uint32_t v = 0xFFFFFF00u; v != 0; ++v) runs.push_back(v);
+
+    auto build = [](const std::vector<uint32_t>& values) {
+        RoaringBitmap bitmap;
+        for (uint32_t value : values) bitmap.add(value);
+        bitmap.optimize();
+        return bitmap;
+    };
+    auto normalized = [](std::vector<uint32_t> values) {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        return values;
+    };
+    const std::vector<uint32_t>* sets[] = { &sparse, &dense, &runs };
+    std::vector<RoaringBitmap> bitmaps;
+    for (const std::vector<uint32_t>* set : sets) {
+        bitmaps.push_back(build(*set));
+        const std::vector<uint32_t> expected = normalized(*set);
+        assert(bitmaps.back().toVector() == expected);
+        assert(bitmaps.back().cardinality() == expected.size());
+        for (int probe = 0; probe < 1000; ++probe) {
+            const uint32_t value = probe % 2 ? expected[static_cast<size_t>(rng() % expected.size())] : static_cast<uint32_t>(rng());
+            assert(bitmaps.back().contains(value) == std::binary_search(expected.begin(), expected.end(), value));
+        }
+    }
+    assert(bitmaps[0].containerKind(0) == RoaringBitmap::ContainerKind::Array);
+    assert(bitmaps[1].containerKind(0) == RoaringBitmap::ContainerKind::Bitmap);
+    assert(bitmaps[2].containerKind(0) == RoaringBitmap::ContainerKind::Run);
+    assert(bitmaps[2].sizeInBytes() < 64);
+
+    for (size_t x = 0; x < 3; ++x) {
+        for (size_t y = 0; y < 3; ++y) {
+            const std::vector<uint32_t> a = normalized(*sets[x]), b = normalized(*sets[y]);
+            std::vector<uint32_t> expectedAnd, expectedOr;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expectedAnd));
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expectedOr));
+            assert((bitmaps[x] & bitmaps[y]).toVector() == expectedAnd);
+            assert((bitmaps[x] | bitmaps[y]).toVector() == expectedOr);
+        }
+    }
+    const RoaringBitmap mixed = bitmaps[1] | build({ (3u << 16) | 5u, 7u });
+    assert(mixed.contains(7) && mixed.contains((3u << 16) | 5u));
+
+    for (const RoaringBitmap& bitmap : bitmaps) {
+        std::stringstream stream;
+        bitmap.write(stream);
+        assert(RoaringBitmap::read(stream) == bitmap);
+    }
+
+    // Produsen batch: hasil jarang (prima), padat (processValue), dan rentang sempit (checkRange).
+    const RoaringBitmap primes = selectWhere(0, 999999, isPrime, 4);
+    assert(primes.cardinality() == 78498 && primes.contains(999983) && !primes.contains(999999));
+    const RoaringBitmap nonNegative = selectWhere(-(1 << 20), (1 << 20) - 1, processValue, 4);
+    assert(nonNegative.cardinality() == (1u << 20) && nonNegative.sizeInBytes() < 256);
+    const RoaringBitmap inRange = selectWhere(-1000, 1000, checkRange);
+    assert(inRange.cardinality() == 100 && inRange.contains(1001) && inRange.contains(1100) && !inRange.contains(1000));
+    assert((selectWhere(-1000, 1000, isPrime) & inRange).cardinality() == 25);
+
+    // Penambahan berurutan: array dipromosikan sekali, bitmap diisi di tempat, optimize memilih run.
+    RoaringBitmap sequential;
+    for (uint32_t v = 0; v < 3 * 65536; ++v) sequential.add(v);
+    assert(sequential.cardinality() == 3 * 65536 && sequential.containerKind(0) == RoaringBitmap::ContainerKind::Bitmap);
+    sequential.add(5);
+    sequential.optimize();
+    assert(sequential.cardinality() == 3 * 65536 && sequential.containerKind(2) == RoaringBitmap::ContainerKind::Run);
+    sequential.add(3 * 65536 + 7);
+    sequential.add(1000); // run yang sudah memuat nilai
+    assert(sequential.cardinality() == 3 * 65536 + 1 && sequential.contains(3 * 65536 + 7));
+
+    try {
+        std::stringstream truncated("RRNG");
+        RoaringBitmap::read(truncated);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+        // Ignored, really
+    }
+
+    // Payload rusak: satu kontainer dengan kunci 0, jenis, kardinalitas, lalu isi mentah.
+    auto encode = [](unsigned kind, uint32_t cardinality, const std::vector<uint16_t>& values, uint64_t fill) {
+        std::string bytes = "RRNG";
+        auto put = [&bytes](uint64_t value, int width) {
+            for (int i = 0; i < width; ++i) bytes.push_back(static_cast<char>(value >> (8 * i)));
+        };
+        put(1, 4);
+        put(0, 2);
+        put(kind, 1);
+        put(cardinality, 4);
+        if (kind == 1) {
+            for (int w = 0; w < 1024; ++w) put(fill, 8);
+        }
+        else {
+            put(values.size(), 4);
+            for (uint16_t value : values) put(value, 2);
+        }
+        return bytes;
+    };
+    const std::string malformed[] = {
+        encode(2, 11, { 65535, 10 }, 0),         // run melewati 65535
+        encode(2, 1, { 5 }, 0),                  // daftar run ganjil
+        encode(2, 8, { 10, 5, 12, 1 }, 0),       // run tumpang tindih
+        encode(2, 3, { 10, 5 }, 0),              // kardinalitas run tidak cocok
+        encode(0, 2, { 5, 3 }, 0),               // array tidak naik
+        encode(0, 2, { 5, 5 }, 0),               // array duplikat
+        encode(0, 3, { 1, 2 }, 0),               // ukuran array != kardinalitas
+        encode(1, 5, {}, 0),                     // popcount bitmap != kardinalitas
+    };
+    for (const std::string& bytes : malformed) {
+        try {
+            std::stringstream stream(bytes);
+            RoaringBitmap::read(stream);
+            assert(false);
+        }
+        catch (const std::invalid_argument&) {
+            // Ignored, really
+        }
+    }
+    std::stringstream valid(encode(1, 65536, {}, UINT64_MAX));
+    assert(RoaringBitmap::read(valid).cardinality() == 65536);
+
+    std::cout << "Semua uji bitmap roaring lulus!\n";
+}
+
+/// <summary>
+/// Titik masuk program yang menjalankan seluruh demonstrasi dan suite pengujian.
+/// </summary>
+/// <returns>Kode keluar proses (0 bila berhasil).</returns>
+/// <remarks>
+/// Bagian ini mengeksekusi tiap modul uji (1..35) dan menuliskan hasilnya ke stdout.
+/// </remarks>
+int main()
+{
+    std::cout << "1. Teori Himpunan\n";
+
+    std::vector<std::vector<bool>> featureCombinations = {
+        {true, true, false},
+        {true, false, true},
+        {false, true, true},
+        {true, true, true}
+    };
+
+    for (const auto& combination : featureCombinations) {
+        testFeatureCombination(combination[0], combination[1], combination[2]);
+    }
+
+    std::cout << "=======================\n";
+    std::cout << "2. Pengujian Kelas Equivalence\n";
+
+    testProcessValue();
+
+    std::cout << "=======================\n";
+    std::cout << "3. Pengujian Keterjangkauan\n";
+
+    // Menguji semua jalur
+    process(10);
+    process(7);
+    process(-5);
+
+    std::cout << "=======================\n";
+    std::cout << "4. Pengujian Batasan\n";
+
+    testCheckRange();
+
+    std::cout << "=======================\n";
+    std::cout << "5. Pengujian Kombinatorial\n";
+
+    testEvaluationCombination();
+
+    std::cout << "=======================\n";
+    std::cout << "6. Pengujian Pengurutan\n";
+
+    testIsSorted();
+
+    std::cout << "=======================\n";
+    std::cout << "7. Diagram Venn\n";
+
+    testClassifyNumber();
+
+    std::cout << "=======================\n";
+    std::cout << "8. Faktorial\n";
+
+    testFactorial();
+
+    std::cout << "=======================\n";
+    std::cout << "9. Fibonacci\n";
+
+    testFibonacci();
+
+    std::cout << "=======================\n";
+    std::cout << "10. Bilangan Prima\n";
+
+    testIsPrime();
+
+
+    std::cout << "=======================\n";
+    std::cout << "11. Saringan Bucket\n";
+
+    testBucketSieve();
+
+
+    std::cout << "=======================\n";
+    std::cout << "12. Indeks Rank/Select Prima\n";
+
+    testPrimeRankSelectIndex();
+
+
+    std::cout << "=======================\n";
+    std::cout << "13. Saringan Linear dan Fungsi Multiplikatif\n";
+
+    testMultiplicativeFunctions();
+
+
+    std::cout << "=======================\n";
+    std::cout << "14. Pembagian Percobaan Invarian\n";
+
+    testTrialDivision();
+
+
+    std::cout << "=======================\n";
+    std::cout << "15. Prima Berikut dan Sebelumnya\n";
+
+    testPrimeWindows();
+
+
+    std::cout << "=======================\n";
+    std::cout << "16. Prima Acak\n";
+
+    testRandomPrimes();
+
+
+    std::cout << "=======================\n";
+    std::cout << "17. Keprimaan Bilangan Besar\n";
+
+    testBigPrimality();
+
+
+    std::cout << "=======================\n";
+    std::cout << "18. Aritmetika Modular\n";
+
+    testModularArithmetic();
+
+
+    std::cout << "=======================\n";
+    std::cout << "19. Rekurensi Linear\n";
+
+    testLinearRecurrence();
+
+
+    std::cout << "=======================\n";
+    std::cout << "20. Kueri Fibonacci dan Zeckendorf\n";
+
+    testFibonacciQueries();
+
+
+    std::cout << "=======================\n";
+    std::cout << "21. Generator Barisan Malas\n";
+
+    testSequenceGenerators();
+
+
+    std::cout << "=======================\n";
+    std::cout << "22. Tabel Memo Konkuren\n";
+
+    testConcurrentMemoTable();
+
+
+    std::cout << "=======================\n";
+    std::cout << "23. Cache Primalitas Bebas Kunci\n";
+
+    testPrimalityCache();
+
+
+    std::cout << "=======================\n";
+    std::cout << "24. Tabel Kombinatorika\n";
+
+    testCombinatoricsTables();
+
+
+    std::cout << "=======================\n";
+    std::cout << "25. Metadata Faktorial\n";
+
+    testFactorialMetadata();
+
+
+    std::cout << "=======================\n";
+    std::cout << "26. API Kode Status\n";
+
+    testStatusApi();
+
+
+    std::cout << "=======================\n";
+    std::cout << "27. Pipeline Predikat Terfusi\n";
+
+    testPipelineFusion();
+
+
+    std::cout << "=======================\n";
+    std::cout << "28. Pemindaian Kolom dengan Zone Map\n";
+
+    testColumnScan();
+
+
+    std::cout << "=======================\n";
+    std::cout << "29. Kueri Rentang pada Data Terurut\n";
+
+    testSortedRangeIndex();
+
+
+    std::cout << "=======================\n";
+    std::cout << "30. Kernel Himpunan Terurut\n";
+
+    testSortedSetKernels();
+
+
+    std::cout << "=======================\n";
+    std::cout << "31. Verifikasi Keterurutan Shard\n";
+
+    testShardedSortedness();
+
+
+    std::cout << "=======================\n";
+    std::cout << "32. isSorted Double, String, dan Kunci Komposit\n";
+
+    testSpecializedIsSorted();
+
+
+    std::cout << "=======================\n";
+    std::cout << "33. Penemuan Batas Otomatis\n";
+
+    testBoundaryDiscovery();
+
+
+    std::cout << "=======================\n";
+    std::cout << "34. Sapuan Kombinasi Dua Parameter\n";
+
+    testCombinationSweep();
+
+
+    std::cout << "=======================\n";
+    std::cout << "35. Bitmap Roaring\n";
+
+    testRoaringBitmap();
 
     return 0;
 }
\ No newline at end of file